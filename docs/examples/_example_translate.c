@@ -44,4 +44,12 @@ printf("Dropdown: %s\n", gui_translate_get(_GT("Dropdown")));
 printf("Listview: %s\n", gui_translate_get(_GT("Listview")));
 
 /* Prints: "Your string here without translate.: Your string here without translate.\n" */
-printf("Your string here without translate.: %s\n", gui_translate_get(_GT("Your string here without translate.")));
\ No newline at end of file
+printf("Your string here without translate.: %s\n", gui_translate_get(_GT("Your string here without translate.")));
+
+/* Translate by ID, generated with "trid -i lang.c -a languageEnglishEntries -o tr_ids.h" */
+
+/* Prints: "Button: Taste\n" */
+printf("Button: %s\n", gui_translate_getid(TR_BUTTON));
+
+/* Widget text follows active language */
+gui_widget_settextid(h, TR_DROPDOWN);
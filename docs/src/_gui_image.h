@@ -10,6 +10,13 @@
  *                  In other words, each image with alpha channel which is not maximum (fully visible) must use more resources to redraw image widget by redrawing parent first.
  *                  On above image is clearly visible how left image has transparency (source data) over button.
  *
+ * Palette-indexed images with `8` (L8) or `4` (L4) bits per pixel are supported when \ref GUI_CFG_USE_IMAGE_INDEXED is enabled.
+ * Each pixel is an index to color look-up table (`clut` field of \ref gui_image_desc_t) of ARGB8888 colors,
+ * which reduces image size by `2-4` times for graphics with small number of colors.
+ *
+ * Image can be scaled and rotated with \ref gui_image_settransform.
+ * For static images, enable cached mode to transform image only once and keep result in memory.
+ *
  * Example code for example above
  * 
  * \include         _example_image.c
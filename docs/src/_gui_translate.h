@@ -7,7 +7,11 @@
  * Both languages must contain the same array for entries in different languages.
  * When translate is performed, index from source table (if found) is used to return string from active table.
  *
- * \note            When translation language is changed, all widget must be manually redrawn to get effect
+ * When languages are changed, all widgets with translated texts are redrawn.
+ *
+ * Instead of comparing strings, text can be selected by ID, which is index of entry in source table.
+ * Header with enumeration of IDs is generated from source table with `tools/trid` host tool.
+ * Widgets with text set by \ref gui_widget_settextid get text of new language when active language changes.
  *
  * \include         _example_translate.c
  *
@@ -1520,5 +1520,10 @@ gui_const gui_font_t GUI_Font_Arial_Bold_18 = {
     0x20,
     0x7f,
     GUI_FLAG_FONT_AA,
-    Arial_Bold_18_CharTable
+    Arial_Bold_18_CharTable,
+    NULL,
+    0,
+    NULL,
+    NULL,
+    NULL
 };
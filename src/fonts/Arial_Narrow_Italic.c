@@ -34382,11 +34382,23 @@ gui_const gui_font_char_t Arial_Narrow_Italic_22_CharTable[] = {
     {  13,   16,  0,    3,    1, Font_Arial_Narrow_Italic_22_2c6f},
 };
 
+gui_const gui_font_range_t Arial_Narrow_Italic_22_Ranges[] = {
+    {0x0020, 0x07cf,    0},
+    {0x2c62, 0x2c62, 1968},
+    {0x2c64, 0x2c64, 1969},
+    {0x2c6d, 0x2c6f, 1970},
+};
+
 gui_const gui_font_t GUI_Font_Arial_Narrow_Italic_22 = {
     _GT("Arial Narrow Italic"),
     22,
     0x0020,
     0x2c6f,
     0,
-    Arial_Narrow_Italic_22_CharTable
+    Arial_Narrow_Italic_22_CharTable,
+    Arial_Narrow_Italic_22_Ranges,
+    GUI_COUNT_OF(Arial_Narrow_Italic_22_Ranges),
+    NULL,
+    NULL,
+    NULL
 };
@@ -833,5 +833,10 @@ gui_const gui_font_t GUI_Font_Calibri_Bold_8 = {
     0x20,
     0x7f,
     0,
-    Calibri_Bold_8_CharTable
+    Calibri_Bold_8_CharTable,
+    NULL,
+    0,
+    NULL,
+    NULL,
+    NULL
 };
@@ -1823,5 +1823,10 @@ gui_const gui_font_t GUI_Font_Comic_Sans_MS_Regular_22 = {
     0x20,
     0x7f,
     0,
-    CharTable
+    CharTable,
+    NULL,
+    0,
+    NULL,
+    NULL,
+    NULL
 };
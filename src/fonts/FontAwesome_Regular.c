@@ -7454,5 +7454,10 @@ gui_const gui_font_t GUI_Font_FontAwesome_Regular_30 = {
     0xf000,
     0xf0ff,
     0,
-    FontAwesome_Regular_30_CharTable
+    FontAwesome_Regular_30_CharTable,
+    NULL,
+    0,
+    NULL,
+    NULL,
+    NULL
 };
@@ -1,10 +1,10 @@
 #include "gui/gui.h"
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0020[1] = {
+gui_const uint8_t Font_Roboto_Italic_14_0020[1] = {
     ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0021[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0021[10] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -17,14 +17,14 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0021[10] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0022[4] = {
+gui_const uint8_t Font_Roboto_Italic_14_0022[4] = {
     _X_X____, 
     _XX_____, 
     X_X_____, 
     X_X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0023[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0023[10] = {
     ____X_X_, 
     ___X__X_, 
     ___X__X_, 
@@ -37,7 +37,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0023[10] = {
     X__X____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0024[13] = {
+gui_const uint8_t Font_Roboto_Italic_14_0024[13] = {
     ____X___, 
     ___X____, 
     __XXXX__, 
@@ -53,7 +53,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0024[13] = {
     __X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0025[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0025[10] = {
     _XXX____, 
     X__X__X_, 
     X__X__X_, 
@@ -66,7 +66,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0025[10] = {
     ____XXX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0026[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0026[10] = {
     ___XXX__, 
     __XX__X_, 
     __X__XX_, 
@@ -79,14 +79,14 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0026[10] = {
     _XXXX_XX, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0027[4] = {
+gui_const uint8_t Font_Roboto_Italic_14_0027[4] = {
     _X______, 
     _X______, 
     X_______, 
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0028[14] = {
+gui_const uint8_t Font_Roboto_Italic_14_0028[14] = {
     ___X____, 
     __X_____, 
     _XX_____, 
@@ -103,7 +103,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0028[14] = {
     _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0029[14] = {
+gui_const uint8_t Font_Roboto_Italic_14_0029[14] = {
     __X_____, 
     ___X____, 
     ___X____, 
@@ -120,7 +120,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0029[14] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002a[6] = {
+gui_const uint8_t Font_Roboto_Italic_14_002a[6] = {
     __X_____, 
     __X_____, 
     XXXXX___, 
@@ -129,7 +129,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_002a[6] = {
     X__X____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002b[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_002b[7] = {
     ___X____, 
     ___X____, 
     __XX____, 
@@ -139,22 +139,22 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_002b[7] = {
     __X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002c[4] = {
+gui_const uint8_t Font_Roboto_Italic_14_002c[4] = {
     _XX_____, 
     _X______, 
     _X______, 
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002d[1] = {
+gui_const uint8_t Font_Roboto_Italic_14_002d[1] = {
     XXXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002e[1] = {
+gui_const uint8_t Font_Roboto_Italic_14_002e[1] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_002f[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_002f[11] = {
     ______X_, 
     _____X__, 
     _____X__, 
@@ -168,7 +168,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_002f[11] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0030[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0030[10] = {
     __XXX___, 
     _X___X__, 
     XX___X__, 
@@ -181,7 +181,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0030[10] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0031[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0031[10] = {
     __XX____, 
     XXXX____, 
     X_X_____, 
@@ -194,7 +194,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0031[10] = {
     _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0032[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0032[10] = {
     ___XXX__, 
     __X___X_, 
     _X____X_, 
@@ -207,7 +207,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0032[10] = {
     XXXXXXX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0033[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0033[10] = {
     ___XXX__, 
     __X___X_, 
     _XX___X_, 
@@ -220,7 +220,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0033[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0034[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0034[10] = {
     _____XX_, 
     ____XXX_, 
     ____XXX_, 
@@ -233,7 +233,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0034[10] = {
     ____X___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0035[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0035[10] = {
     __XXXXX_, 
     _XX_____, 
     _X______, 
@@ -246,7 +246,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0035[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0036[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0036[10] = {
     ___XXX__, 
     __XX____, 
     _X______, 
@@ -259,7 +259,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0036[10] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0037[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0037[10] = {
     XXXXXXX_, 
     _____X__, 
     _____X__, 
@@ -272,7 +272,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0037[10] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0038[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0038[10] = {
     __XXX___, 
     _X___X__, 
     _X___X__, 
@@ -285,7 +285,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0038[10] = {
     XXXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0039[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0039[10] = {
     __XXX___, 
     _X__XX__, 
     X____X__, 
@@ -298,7 +298,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0039[10] = {
     XXX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003a[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_003a[7] = {
     _XX_____, 
     ________, 
     ________, 
@@ -308,7 +308,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_003a[7] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003b[9] = {
+gui_const uint8_t Font_Roboto_Italic_14_003b[9] = {
     __XX____, 
     ________, 
     ________, 
@@ -320,7 +320,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_003b[9] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003c[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_003c[7] = {
     ______X_, 
     ____XX__, 
     __XXX___, 
@@ -330,14 +330,14 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_003c[7] = {
     ____X___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003d[4] = {
+gui_const uint8_t Font_Roboto_Italic_14_003d[4] = {
     XXXXXX__, 
     ________, 
     ________, 
     XXXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003e[6] = {
+gui_const uint8_t Font_Roboto_Italic_14_003e[6] = {
     _XX_____, 
     ___XX___, 
     _____XX_, 
@@ -346,7 +346,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_003e[6] = {
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_003f[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_003f[10] = {
     _XXXX___, 
     XX__X___, 
     ____X___, 
@@ -359,7 +359,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_003f[10] = {
     _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0040[26] = {
+gui_const uint8_t Font_Roboto_Italic_14_0040[26] = {
     _____XXX, X_______, 
     ____X___, _X______, 
     ___X____, __X_____, 
@@ -375,7 +375,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0040[26] = {
     __XXXXX_, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0041[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_0041[20] = {
     ______X_, ________, 
     _____XX_, ________, 
     _____XX_, ________, 
@@ -388,7 +388,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0041[20] = {
     XX______, X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0042[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0042[10] = {
     __XXXXX_, 
     __X___XX, 
     __X____X, 
@@ -401,7 +401,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0042[10] = {
     XXXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0043[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0043[10] = {
     __XXXX__, 
     _XX___X_, 
     _X____XX, 
@@ -414,7 +414,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0043[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0044[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0044[10] = {
     __XXXXX_, 
     __X___XX, 
     __X____X, 
@@ -427,7 +427,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0044[10] = {
     XXXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0045[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0045[10] = {
     __XXXXXX, 
     __X_____, 
     __X_____, 
@@ -440,7 +440,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0045[10] = {
     XXXXXXX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0046[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0046[10] = {
     __XXXXXX, 
     __X_____, 
     __X_____, 
@@ -453,7 +453,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0046[10] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0047[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0047[10] = {
     __XXXXX_, 
     _XX___X_, 
     _X____XX, 
@@ -466,7 +466,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0047[10] = {
     _XXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0048[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_0048[20] = {
     __X_____, XX______, 
     __X_____, X_______, 
     __X_____, X_______, 
@@ -479,7 +479,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0048[20] = {
     XX_____X, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0049[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0049[10] = {
     __XX____, 
     __X_____, 
     __X_____, 
@@ -492,7 +492,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0049[10] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004a[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_004a[10] = {
     ______XX, 
     ______X_, 
     ______X_, 
@@ -505,7 +505,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004a[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004b[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_004b[20] = {
     __X____X, X_______, 
     __X___XX, ________, 
     __X__XX_, ________, 
@@ -518,7 +518,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004b[20] = {
     XX____XX, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004c[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_004c[10] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -531,7 +531,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004c[10] = {
     XXXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004d[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_004d[20] = {
     __XX____, __XX____, 
     __XX____, _XX_____, 
     __XX____, _XX_____, 
@@ -544,7 +544,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004d[20] = {
     XX___X__, _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004e[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_004e[20] = {
     __XX____, XX______, 
     __XX____, X_______, 
     __XXX___, X_______, 
@@ -557,7 +557,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004e[20] = {
     XX____XX, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_004f[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_004f[10] = {
     __XXXX__, 
     _XX___X_, 
     _X____XX, 
@@ -570,7 +570,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_004f[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0050[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_0050[20] = {
     __XXXXX_, ________, 
     __X____X, ________, 
     __X____X, X_______, 
@@ -583,7 +583,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0050[20] = {
     XX______, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0051[12] = {
+gui_const uint8_t Font_Roboto_Italic_14_0051[12] = {
     __XXXX__, 
     _XX___X_, 
     _X____XX, 
@@ -598,7 +598,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0051[12] = {
     _____XX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0052[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0052[10] = {
     __XXXXX_, 
     __X___XX, 
     __X____X, 
@@ -611,7 +611,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0052[10] = {
     XX____X_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0053[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0053[10] = {
     ___XXXX_, 
     __X___XX, 
     _XX____X, 
@@ -624,7 +624,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0053[10] = {
     _XXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0054[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0054[10] = {
     XXXXXXXX, 
     ___X____, 
     ___X____, 
@@ -637,7 +637,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0054[10] = {
     __X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0055[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0055[10] = {
     _X_____X, 
     _X____XX, 
     _X____XX, 
@@ -650,7 +650,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0055[10] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0056[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0056[10] = {
     XX_____X, 
     XX____XX, 
     _X____X_, 
@@ -663,7 +663,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0056[10] = {
     __XX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0057[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_0057[20] = {
     XX___XX_, __XX____, 
     XX___XX_, __X_____, 
     _X__XXX_, _XX_____, 
@@ -676,7 +676,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0057[20] = {
     _XX____X, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0058[20] = {
+gui_const uint8_t Font_Roboto_Italic_14_0058[20] = {
     _XX____X, X_______, 
     __X___XX, ________, 
     ___X__X_, ________, 
@@ -689,7 +689,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0058[20] = {
     XX____X_, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0059[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0059[10] = {
     XX____XX, 
     _X____X_, 
     _X___X__, 
@@ -702,7 +702,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0059[10] = {
     __X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005a[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_005a[10] = {
     __XXXXXX, 
     _X____XX, 
     _____XX_, 
@@ -715,7 +715,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_005a[10] = {
     XXXXXXX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005b[13] = {
+gui_const uint8_t Font_Roboto_Italic_14_005b[13] = {
     __XXX___, 
     __X_____, 
     __X_____, 
@@ -731,7 +731,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_005b[13] = {
     XXX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005c[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_005c[11] = {
     XX______, 
     _X______, 
     _X______, 
@@ -745,7 +745,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_005c[11] = {
     __XX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005d[13] = {
+gui_const uint8_t Font_Roboto_Italic_14_005d[13] = {
     __XXX___, 
     ___X____, 
     ___X____, 
@@ -761,7 +761,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_005d[13] = {
     XXX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005e[5] = {
+gui_const uint8_t Font_Roboto_Italic_14_005e[5] = {
     __X_____, 
     __XX____, 
     _X_X____, 
@@ -769,16 +769,16 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_005e[5] = {
     X__X____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_005f[1] = {
+gui_const uint8_t Font_Roboto_Italic_14_005f[1] = {
     XXXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0060[2] = {
+gui_const uint8_t Font_Roboto_Italic_14_0060[2] = {
     XX______, 
     __X_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0061[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_0061[8] = {
     ____X___, 
     __XXXX__, 
     _X___XX_, 
@@ -789,7 +789,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0061[8] = {
     _XXX_X__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0062[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0062[11] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -803,7 +803,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0062[11] = {
     XXXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0063[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_0063[8] = {
     ___X____, 
     _XXXX___, 
     X____X__, 
@@ -814,7 +814,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0063[8] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0064[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0064[11] = {
     ______X_, 
     _____XX_, 
     _____X__, 
@@ -828,7 +828,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0064[11] = {
     XXXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0065[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_0065[8] = {
     ___X____, 
     _XXXX___, 
     X____X__, 
@@ -839,7 +839,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0065[8] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0066[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0066[11] = {
     ___XX___, 
     __X_X___, 
     _XX_____, 
@@ -853,7 +853,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0066[11] = {
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0067[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0067[11] = {
     ___X____, 
     __XXXXX_, 
     _X____X_, 
@@ -867,7 +867,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0067[11] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0068[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0068[11] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -881,7 +881,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0068[11] = {
     XX___X__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0069[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0069[10] = {
     __X_____, 
     ________, 
     ________, 
@@ -894,7 +894,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0069[10] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006a[13] = {
+gui_const uint8_t Font_Roboto_Italic_14_006a[13] = {
     ____X___, 
     ________, 
     ________, 
@@ -910,7 +910,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006a[13] = {
     XXX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006b[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_006b[11] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -924,7 +924,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006b[11] = {
     XX__XX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006c[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_006c[11] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -938,7 +938,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006c[11] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006d[16] = {
+gui_const uint8_t Font_Roboto_Italic_14_006d[16] = {
     ____X___, X_______, 
     _XXXXXXX, XXX_____, 
     _X___XX_, __X_____, 
@@ -949,7 +949,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006d[16] = {
     XX___X__, _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006e[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_006e[8] = {
     ____X___, 
     _XXXXX__, 
     _XX__XX_, 
@@ -960,7 +960,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006e[8] = {
     XX___X__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_006f[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_006f[8] = {
     ___X____, 
     _XXXX___, 
     X____X__, 
@@ -971,7 +971,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_006f[8] = {
     _XXX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0070[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0070[11] = {
     ____X___, 
     _XXXXXX_, 
     _X____X_, 
@@ -985,7 +985,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0070[11] = {
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0071[11] = {
+gui_const uint8_t Font_Roboto_Italic_14_0071[11] = {
     __X_____, 
     _XXXXX__, 
     X____X__, 
@@ -999,7 +999,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0071[11] = {
     ___XX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0072[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_0072[8] = {
     ____X___, 
     _XXXX___, 
     _XX_____, 
@@ -1010,7 +1010,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0072[8] = {
     XX______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0073[8] = {
+gui_const uint8_t Font_Roboto_Italic_14_0073[8] = {
     ___X____, 
     __XXXX__, 
     _X___X__, 
@@ -1021,7 +1021,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0073[8] = {
     _XXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0074[9] = {
+gui_const uint8_t Font_Roboto_Italic_14_0074[9] = {
     __X_____, 
     __X_____, 
     XXXXX___, 
@@ -1033,7 +1033,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0074[9] = {
     _XX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0075[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_0075[7] = {
     XX___X__, 
     X____X__, 
     X___XX__, 
@@ -1043,7 +1043,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0075[7] = {
     XXXXX___, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0076[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_0076[7] = {
     X___XX__, 
     X___X___, 
     X__X____, 
@@ -1053,7 +1053,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0076[7] = {
     _X______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0077[14] = {
+gui_const uint8_t Font_Roboto_Italic_14_0077[14] = {
     X___X___, X_______, 
     X__XX__X, X_______, 
     X__XX__X, ________, 
@@ -1063,7 +1063,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0077[14] = {
     _X___X__, ________, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0078[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_0078[7] = {
     _XX__XX_, 
     __X_X___, 
     __XXX___, 
@@ -1073,7 +1073,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0078[7] = {
     X___XX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_0079[10] = {
+gui_const uint8_t Font_Roboto_Italic_14_0079[10] = {
     __X___XX, 
     __X___X_, 
     __X__X__, 
@@ -1086,7 +1086,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_0079[10] = {
     XXX_____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007a[7] = {
+gui_const uint8_t Font_Roboto_Italic_14_007a[7] = {
     _XXXXXX_, 
     ____XX__, 
     ___XX___, 
@@ -1096,7 +1096,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_007a[7] = {
     XXXXXX__, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007b[14] = {
+gui_const uint8_t Font_Roboto_Italic_14_007b[14] = {
     ____X___, 
     ___X____, 
     ___X____, 
@@ -1113,7 +1113,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_007b[14] = {
     __XX____, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007c[12] = {
+gui_const uint8_t Font_Roboto_Italic_14_007c[12] = {
     __X_____, 
     __X_____, 
     __X_____, 
@@ -1128,7 +1128,7 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_007c[12] = {
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007d[14] = {
+gui_const uint8_t Font_Roboto_Italic_14_007d[14] = {
     __X_____, 
     ___X____, 
     ___X____, 
@@ -1145,17 +1145,17 @@ GUI_Const GUI_Byte Font_Roboto_Italic_14_007d[14] = {
     X_______, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007e[2] = {
+gui_const uint8_t Font_Roboto_Italic_14_007e[2] = {
     XXXX__XX, 
     X__XXXX_, 
 };
 
-GUI_Const GUI_Byte Font_Roboto_Italic_14_007f[1] = {
+gui_const uint8_t Font_Roboto_Italic_14_007f[1] = {
     ________, 
 };
 
 
-GUI_Const GUI_FONT_CharInfo_t Roboto_Italic_14_CharTable[] = {
+gui_const gui_font_char_t Roboto_Italic_14_CharTable[] = {
     {   5,    1,  0,    0,    1, Font_Roboto_Italic_14_0020},
     {   3,   10,  0,    2,    1, Font_Roboto_Italic_14_0021},
     {   4,    4,  0,    1,    1, Font_Roboto_Italic_14_0022},
@@ -1254,11 +1254,16 @@ GUI_Const GUI_FONT_CharInfo_t Roboto_Italic_14_CharTable[] = {
     {   5,    1,  0,    0,    1, Font_Roboto_Italic_14_007f},
 };
 
-const GUI_FONT_t GUI_Font_Roboto_Italic_14 = {
+gui_const gui_font_t GUI_Font_Roboto_Italic_14 = {
     _GT("Roboto Italic"),
     14,
     0x0020,
-    0x2c6f,
+    0x007f,
     0,
-    Roboto_Italic_14_CharTable
+    Roboto_Italic_14_CharTable,
+    NULL,
+    0,
+    NULL,
+    NULL,
+    NULL
 };
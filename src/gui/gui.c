@@ -140,6 +140,14 @@ redraw_widgets(gui_handle_p parent, uint8_t force_redraw) {
                 /* Prepare clipping region for this widget drawing */
                 check_disp_clipping(h);             /* Check coordinates for drawings only particular widget */
 
+#if GUI_CFG_USE_EFFECTS
+                /*
+                 * Draw shadow and blurred backdrop to parent layer before widget.
+                 * Content under widget is new only when drawn together with parent
+                 */
+                guii_effect_draw(h, force_redraw);
+#endif /* GUI_CFG_USE_EFFECTS */
+
 #if GUI_CFG_USE_ALPHA
                 /* Check alpha and check if blending function exists to merge layers later together */
                 if (guii_widget_hasalpha(h) /* && GUI.ll.CopyBlend != NULL */) {
@@ -147,9 +155,10 @@ redraw_widgets(gui_handle_p parent, uint8_t force_redraw) {
                     gui_dim_t height = GUI.display_temp.y2 - GUI.display_temp.y1;
                     
                     /* Try to allocate memory for new virtual layer for temporary usage */
-                    GUI.lcd.drawing_layer = GUI_MEMALLOC(sizeof(*GUI.lcd.drawing_layer) + (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size);
+                    GUI.lcd.drawing_layer = GUI_MEMFRAMEALLOC(sizeof(*GUI.lcd.drawing_layer) + (size_t)width * (size_t)height * (size_t)GUI.lcd.pixel_size);
                     
                     if (GUI.lcd.drawing_layer != NULL) {/* Check if allocation was successful */
+                        GUI_MEMFRAMETAG(GUI.lcd.drawing_layer, GUI_MEM_TAG_LAYER);
                         GUI.lcd.drawing_layer->width = width;
                         GUI.lcd.drawing_layer->height = height;
                         GUI.lcd.drawing_layer->x_pos = GUI.display_temp.x1;
@@ -223,7 +232,7 @@ redraw_widgets(gui_handle_p parent, uint8_t force_redraw) {
                         }                        
                     }
                     
-                    GUI_MEMFREE(GUI.lcd.drawing_layer); /* Free memory for virtual layer */
+                    GUI_MEMFRAMEFREE(GUI.lcd.drawing_layer);/* Free memory for virtual layer */
                     GUI.lcd.drawing_layer = layerPrev;  /* Reset layer pointer */
                 }
 #endif /* GUI_CFG_USE_ALPHA */
@@ -760,6 +769,9 @@ process_redraw(void) {
     /* Draw clipping area rectangle on screen for debug */
     //gui_draw_rectangle(&GUI.display, GUI.display.x1, GUI.display.y1, GUI.display.x2, GUI.display.y2, GUI_COLOR_RED);
     
+    /* Copy clipping data to region, low-level may use it to update rotated display */
+    memcpy(&drawing->display, &GUI.display, sizeof(GUI.display));
+    
     /* Notify low-level about layer change */
     GUI.lcd.flags |= GUI_FLAG_LCD_WAIT_LAYER_CONFIRM;
     gui_ll_control(&GUI.lcd, GUI_LL_Command_SetActiveLayer, &drawing, &result); /* Set new active layer to low-level driver */
@@ -769,13 +781,15 @@ process_redraw(void) {
     GUI.lcd.active_layer = drawing;
     GUI.lcd.drawing_layer = active;
     
-    memcpy(&GUI.lcd.active_layer->display, &GUI.display, sizeof(GUI.display));  /* Copy clipping data to region */
-    
     /* Invalid clipping region(s) for next drawing process */
     GUI.display.x1 = GUI_DIM_MAX;
     GUI.display.y1 = GUI_DIM_MAX;
     GUI.display.x2 = GUI_DIM_MIN;
     GUI.display.y2 = GUI_DIM_MIN;
+
+#if GUI_CFG_USE_MEM_FRAME
+    gui_mem_frame_reset();                          /* Release memory of this redraw */
+#endif /* GUI_CFG_USE_MEM_FRAME */
 }
 
 /**
@@ -827,6 +841,13 @@ gui_init(void) {
     gui_ll_control(&GUI.lcd, GUI_LL_Command_Init, &GUI.ll, &result);/* Call low-level initialization */
     GUI.ll.Init(&GUI.lcd);                          /* Call user LCD driver function */
     
+    /* Widgets are drawn in logical coordinates, low-level rotates content to panel */
+    if (GUI.lcd.orientation == GUI_LCD_ORIENTATION_90 || GUI.lcd.orientation == GUI_LCD_ORIENTATION_270) {
+        gui_dim_t tmp = GUI.lcd.width;
+        GUI.lcd.width = GUI.lcd.height;
+        GUI.lcd.height = tmp;
+    }
+    
     /* Check situation with layers */
     if (GUI.lcd.layer_count >= 1) {
         size_t i;
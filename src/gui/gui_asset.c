@@ -0,0 +1,551 @@
+/**	
+ * \file            gui_asset.c
+ * \brief           Binary font and image assets
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_asset.h"
+#include "gui/gui_text.h"
+#if GUI_CFG_ASSET_MMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* GUI_CFG_ASSET_MMAP */
+
+#if GUI_CFG_USE_ASSET || __DOXYGEN__
+
+#define ASSET_VERSION               2       /* Version 2 adds kerning to font section */
+#define ASSET_HDR_SIZE              16
+#define ASSET_FONT_HDR_SIZE         40
+#define ASSET_FONT_HDR_SIZE_V1      32
+#define ASSET_IMAGE_HDR_SIZE        20
+#define ASSET_CHAR_SIZE             16
+#define ASSET_RANGE_SIZE            12
+#define ASSET_KERN_SIZE             6
+#define ASSET_TABLE_CHUNK           16      /* Number of table entries read at a time */
+
+/**
+ * \brief           Asset source while loading
+ */
+typedef struct {
+    gui_asset_read_fn read_fn;              /*!< Block read function */
+    void* arg;                              /*!< Read function argument */
+    uint32_t data_offset;                   /*!< Data region offset */
+    uint32_t data_size;                     /*!< Data region size */
+    const uint8_t* data;                    /*!< Data region in addressable memory */
+} asset_src_t;
+
+/**
+ * \brief           Memory source for \ref gui_asset_load
+ */
+typedef struct {
+    const uint8_t* data;                    /*!< Asset start address */
+    size_t len;                             /*!< Asset length in units of bytes */
+} asset_mem_t;
+
+/**
+ * \brief           Get little endian 16-bit value
+ */
+static uint16_t
+asset_u16(const uint8_t* p) {
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+/**
+ * \brief           Get little endian 32-bit value
+ */
+static uint32_t
+asset_u32(const uint8_t* p) {
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/**
+ * \brief           Read function for assets in addressable memory
+ * \param[in]       arg: Pointer to \ref asset_mem_t structure
+ * \param[in]       offset: Read offset
+ * \param[out]      data: Memory to read data to
+ * \param[in]       len: Number of bytes to read
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+asset_mem_read(void* arg, uint32_t offset, void* data, size_t len) {
+    asset_mem_t* mem = arg;
+
+    if (offset > mem->len || len > mem->len - offset) {
+        return 0;
+    }
+    memcpy(data, &mem->data[offset], len);
+    return 1;
+}
+
+/**
+ * \brief           Get pointer to object inside data region
+ * \param[in]       src: Asset source
+ * \param[in]       offset: Object offset from start of asset
+ * \param[in]       size: Object size in units of bytes
+ * \return          Pointer to object on success, `NULL` when object is not inside data region
+ */
+static const uint8_t *
+asset_ptr(const asset_src_t* src, uint32_t offset, uint32_t size) {
+    if (offset < src->data_offset || offset - src->data_offset > src->data_size
+        || size > src->data_size - (offset - src->data_offset)) {
+        return NULL;
+    }
+    return &src->data[offset - src->data_offset];
+}
+
+/**
+ * \brief           Check that character data has all bytes, decoder reads for character
+ *
+ *                  Packed data needs full lines of pixels. Run-length encoded data
+ *                  is walked packet by packet, the same way as decoder reads it,
+ *                  and must end inside data
+ *
+ * \param[in]       font: Font with valid flags
+ * \param[in]       c: Character with valid size and data pointer
+ * \param[in]       size: Size of character data in units of bytes
+ * \return          `1` when data are complete, `0` otherwise
+ */
+static uint8_t
+asset_checkchar(const gui_font_t* font, const gui_font_char_t* c, uint32_t size) {
+    uint32_t pixels, used, n;
+    uint8_t bpp, b;
+
+    bpp = gui_text_getfontbpp(font);
+    pixels = (uint32_t)c->x_size * c->y_size;
+    if (!(font->flags & GUI_FLAG_FONT_RLE)) {
+        return size >= (((uint32_t)c->x_size * bpp + 7) >> 3) * c->y_size;
+    }
+    for (used = 0; pixels > 0; pixels -= n) {
+        if (used >= size) {
+            return 0;
+        }
+        b = c->data[used++];
+        if (b & 0x80) {                             /* Literal, decoder reads only bytes of used pixels */
+            n = GUI_MIN((uint32_t)(b & 0x7F) + 1, pixels);
+            used += (n * bpp + 7) >> 3;
+        } else if (bpp == 8) {                      /* Run with value in next byte */
+            n = GUI_MIN((uint32_t)b + 1, pixels);
+            used++;
+        } else {
+            n = GUI_MIN((uint32_t)(b & ((1 << (7 - bpp)) - 1)) + 1, pixels);
+        }
+    }
+    return used <= size;
+}
+
+/**
+ * \brief           Build font structure from asset tables
+ * \param[in,out]   asset: Asset to build font for
+ * \param[in]       src: Asset source with valid data region
+ * \param[in]       hdr: Header and font section
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+asset_loadfont(gui_asset_t* asset, const asset_src_t* src, const uint8_t* hdr) {
+    uint8_t buff[ASSET_TABLE_CHUNK * ASSET_CHAR_SIZE];
+    const uint8_t *name, *p;
+    gui_font_char_t* chars;
+    gui_font_range_t* ranges;
+    gui_font_kern_t* kerning;
+    uint16_t* kerning_index;
+    uint32_t char_count, range_count, name_offset, chars_offset, ranges_offset, kern_count, kern_offset, i, k, n;
+
+    char_count = asset_u32(&hdr[28]);
+    range_count = asset_u32(&hdr[32]);
+    name_offset = asset_u32(&hdr[36]);
+    chars_offset = asset_u32(&hdr[40]);
+    ranges_offset = asset_u32(&hdr[44]);
+    kern_count = hdr[4] > 1 ? asset_u32(&hdr[48]) : 0;
+    kern_offset = hdr[4] > 1 ? asset_u32(&hdr[52]) : 0;
+
+    /* Name must be terminated inside data region */
+    name = asset_ptr(src, name_offset, 1);
+    if (name == NULL || memchr(name, 0, src->data_size - (name_offset - src->data_offset)) == NULL
+        || char_count == 0 || char_count > 0xFFFF || range_count > 0xFFFF || kern_count > 0xFFFF
+        || asset_u32(&hdr[20]) > 0xFFFF || asset_u32(&hdr[24]) > 0xFFFF) {
+        return 0;
+    }
+
+    asset->tables = GUI_MEMALLOC(char_count * sizeof(*chars) + range_count * sizeof(*ranges)
+        + kern_count * sizeof(*kerning) + (kern_count ? (char_count + 1) * sizeof(*kerning_index) : 0));
+    if (asset->tables == NULL) {
+        return 0;
+    }
+    chars = asset->tables;
+    ranges = (gui_font_range_t *)&chars[char_count];
+    kerning = (gui_font_kern_t *)&ranges[range_count];
+    kerning_index = (uint16_t *)&kerning[kern_count];
+    asset->font.flags = hdr[17];                    /* Flags define character data format */
+
+    /* Read character table in chunks and point characters to data region */
+    for (i = 0; i < char_count; i += n) {
+        n = GUI_MIN(char_count - i, ASSET_TABLE_CHUNK);
+        if (!src->read_fn(src->arg, chars_offset + i * ASSET_CHAR_SIZE, buff, n * ASSET_CHAR_SIZE)) {
+            return 0;
+        }
+        for (k = 0, p = buff; k < n; k++, p += ASSET_CHAR_SIZE) {
+            chars[i + k].x_size = p[0];
+            chars[i + k].y_size = p[1];
+            chars[i + k].x_pos = p[2];
+            chars[i + k].y_pos = p[3];
+            chars[i + k].x_margin = p[4];
+            chars[i + k].data = asset_ptr(src, asset_u32(&p[8]), asset_u32(&p[12]));
+            if (chars[i + k].data == NULL || !asset_checkchar(&asset->font, &chars[i + k], asset_u32(&p[12]))) {
+                return 0;
+            }
+        }
+    }
+
+    /* Read range table */
+    for (i = 0; i < range_count; i += n) {
+        n = GUI_MIN(range_count - i, ASSET_TABLE_CHUNK);
+        if (!src->read_fn(src->arg, ranges_offset + i * ASSET_RANGE_SIZE, buff, n * ASSET_RANGE_SIZE)) {
+            return 0;
+        }
+        for (k = 0, p = buff; k < n; k++, p += ASSET_RANGE_SIZE) {
+            ranges[i + k].first = asset_u32(&p[0]);
+            ranges[i + k].last = asset_u32(&p[4]);
+            ranges[i + k].index = (uint16_t)asset_u32(&p[8]);
+            if (ranges[i + k].last < ranges[i + k].first || asset_u32(&p[8]) >= char_count
+                || ranges[i + k].last - ranges[i + k].first >= char_count - asset_u32(&p[8])) {
+                return 0;
+            }
+        }
+    }
+    if (range_count == 0 && asset_u32(&hdr[24]) - asset_u32(&hdr[20]) >= char_count) {
+        return 0;                                   /* Direct indexing needs all characters */
+    }
+
+    /* Read kerning pairs, they must be sorted, and build index of first pair for every character */
+    for (i = 0; i < kern_count; i += n) {
+        n = GUI_MIN(kern_count - i, ASSET_TABLE_CHUNK);
+        if (!src->read_fn(src->arg, kern_offset + i * ASSET_KERN_SIZE, buff, n * ASSET_KERN_SIZE)) {
+            return 0;
+        }
+        for (k = 0, p = buff; k < n; k++, p += ASSET_KERN_SIZE) {
+            kerning[i + k].first = asset_u16(&p[0]);
+            kerning[i + k].second = asset_u16(&p[2]);
+            kerning[i + k].value = (int8_t)p[4];
+            if (kerning[i + k].first >= char_count || kerning[i + k].second >= char_count
+                || (i + k > 0 && (kerning[i + k].first < kerning[i + k - 1].first
+                    || (kerning[i + k].first == kerning[i + k - 1].first && kerning[i + k].second <= kerning[i + k - 1].second)))) {
+                return 0;
+            }
+        }
+    }
+    if (kern_count > 0) {
+        for (i = 0, k = 0; i <= char_count; i++) {
+            while (k < kern_count && kerning[k].first < i) {
+                k++;
+            }
+            kerning_index[i] = (uint16_t)k;
+        }
+        asset->font.kerning = kerning;
+        asset->font.kerning_index = kerning_index;
+    }
+
+    asset->font.name = (const gui_char *)name;
+    asset->font.size = hdr[16];
+    asset->font.startchar = (uint16_t)asset_u32(&hdr[20]);
+    asset->font.endchar = (uint16_t)asset_u32(&hdr[24]);
+    asset->font.data = chars;
+    asset->font.ranges = range_count ? ranges : NULL;
+    asset->font.ranges_count = (uint16_t)range_count;
+    return 1;
+}
+
+/**
+ * \brief           Build image descriptor from asset
+ * \param[in,out]   asset: Asset to build image for
+ * \param[in]       src: Asset source with valid data region
+ * \param[in]       hdr: Header and image section
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+asset_loadimage(gui_asset_t* asset, const asset_src_t* src, const uint8_t* hdr) {
+    uint32_t image_offset = asset_u32(&hdr[24]), image_size = asset_u32(&hdr[28]), stride;
+    uint32_t clut_offset = asset_u32(&hdr[32]);
+    uint16_t clut_size = asset_u16(&hdr[22]);
+
+    asset->image.x_size = (gui_dim_t)asset_u16(&hdr[16]);
+    asset->image.y_size = (gui_dim_t)asset_u16(&hdr[18]);
+    asset->image.bpp = hdr[20];
+    asset->image.image = asset_ptr(src, image_offset, image_size);
+    if (asset->image.image == NULL || asset->image.x_size <= 0 || asset->image.y_size <= 0) {
+        return 0;
+    }
+
+    /* Only formats drawing functions support, palette-indexed images have CLUT, others do not */
+    switch (asset->image.bpp) {
+        case 4:
+        case 8:
+            if (!clut_offset) {
+                return 0;
+            }
+            stride = asset->image.bpp == 8 ? (uint32_t)asset->image.x_size : ((uint32_t)asset->image.x_size + 1) >> 1;
+            break;
+        case 16:
+        case 24:
+        case 32:
+            if (clut_offset || (image_offset & 0x03)) {
+                return 0;
+            }
+            stride = (uint32_t)asset->image.x_size * (asset->image.bpp >> 3);
+            break;
+        default:
+            return 0;
+    }
+    if (image_size / stride < (uint32_t)asset->image.y_size) {
+        return 0;                                   /* Image data are shorter than all lines */
+    }
+    if (clut_offset) {
+        if ((clut_offset & 0x03) || clut_size == 0 || clut_size > 256
+            || asset_ptr(src, clut_offset, clut_size * sizeof(gui_color_t)) == NULL) {
+            return 0;
+        }
+        asset->image.clut = (const gui_color_t *)asset_ptr(src, clut_offset, clut_size * sizeof(gui_color_t));
+        asset->image.clut_size = clut_size;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Load asset from source
+ * \param[in,out]   asset: Asset to load
+ * \param[in]       src: Asset source. When `data` member is `NULL`, data region is copied to GUI memory
+ * \return          `1` on success, `0` otherwise
+ */
+static uint8_t
+asset_load(gui_asset_t* asset, asset_src_t* src) {
+    uint8_t hdr[ASSET_HDR_SIZE + ASSET_FONT_HDR_SIZE], ok = 0;
+    const uint8_t* mem = src->data;
+
+    memset(asset, 0x00, sizeof(*asset));
+    if (!src->read_fn(src->arg, 0, hdr, ASSET_HDR_SIZE)
+        || memcmp(hdr, "EGUI", 4) || hdr[4] == 0 || hdr[4] > ASSET_VERSION) {
+        return 0;
+    }
+    src->data_offset = asset_u32(&hdr[8]);
+    src->data_size = asset_u32(&hdr[12]);
+    if ((src->data_offset & 0x03) || src->data_size == 0) {
+        return 0;
+    }
+    if (mem != NULL) {                              /* Use data region in place */
+        src->data = mem + src->data_offset;
+    } else {                                        /* Copy data region to memory */
+        asset->data = GUI_MEMALLOC(src->data_size);
+        if (asset->data == NULL || !src->read_fn(src->arg, src->data_offset, asset->data, src->data_size)) {
+            gui_asset_unload(asset);
+            return 0;
+        }
+        src->data = asset->data;
+    }
+
+    switch (hdr[5]) {
+        case GUI_ASSET_TYPE_FONT:
+            if (src->read_fn(src->arg, ASSET_HDR_SIZE, &hdr[ASSET_HDR_SIZE], hdr[4] > 1 ? ASSET_FONT_HDR_SIZE : ASSET_FONT_HDR_SIZE_V1)) {
+                ok = asset_loadfont(asset, src, hdr);
+            }
+            break;
+        case GUI_ASSET_TYPE_IMAGE:
+            if (src->read_fn(src->arg, ASSET_HDR_SIZE, &hdr[ASSET_HDR_SIZE], ASSET_IMAGE_HDR_SIZE)) {
+                ok = asset_loadimage(asset, src, hdr);
+            }
+            break;
+        default:
+            break;
+    }
+    if (!ok) {
+        gui_asset_unload(asset);
+        return 0;
+    }
+    asset->type = (gui_asset_type_t)hdr[5];
+    return 1;
+}
+
+/**
+ * \brief           Load font or image asset from addressable memory
+ *
+ *                  Asset is used in place, memory must stay valid until \ref gui_asset_unload is called.
+ *                  Only character and range tables are allocated in GUI memory
+ *
+ * \note            Use this function for assets in memory mapped flash or files mapped by application
+ * \param[out]      asset: Asset structure to load to
+ * \param[in]       data: Asset start address, must be aligned to `4` bytes
+ * \param[in]       len: Asset length in units of bytes
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_asset_load(gui_asset_t* asset, const void* data, size_t len) {
+    asset_mem_t mem;
+    asset_src_t src = {0};
+
+    GUI_ASSERTPARAMS(asset != NULL && data != NULL && len > 0);
+
+    mem.data = data;
+    mem.len = len;
+    src.read_fn = asset_mem_read;
+    src.arg = &mem;
+    src.data = data;
+    if (len < ASSET_HDR_SIZE || asset_u32(&mem.data[8]) > len || asset_u32(&mem.data[12]) > len - asset_u32(&mem.data[8])) {
+        memset(asset, 0x00, sizeof(*asset));
+        return 0;
+    }
+    return asset_load(asset, &src);
+}
+
+/**
+ * \brief           Load font or image asset with block read function
+ *
+ *                  Data region of asset is copied to GUI memory,
+ *                  use it when asset is not in addressable memory, such as SPI flash or file system
+ *
+ * \param[out]      asset: Asset structure to load to
+ * \param[in]       read_fn: Block read function
+ * \param[in]       arg: User argument passed to read function
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_asset_loadread(gui_asset_t* asset, gui_asset_read_fn read_fn, void* arg) {
+    asset_src_t src = {0};
+
+    GUI_ASSERTPARAMS(asset != NULL && read_fn != NULL);
+
+    src.read_fn = read_fn;
+    src.arg = arg;
+    return asset_load(asset, &src);
+}
+
+#if GUI_CFG_ASSET_MMAP || __DOXYGEN__
+
+/**
+ * \brief           Map asset file to memory and load it
+ *
+ *                  File is mapped read-only and used in place, it is unmapped by \ref gui_asset_unload
+ *
+ * \note            Available when \ref GUI_CFG_ASSET_MMAP is enabled
+ * \param[out]      asset: Asset structure to load to
+ * \param[in]       path: Path to asset file
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_asset_open(gui_asset_t* asset, const char* path) {
+    struct stat st;
+    void* map;
+    int fd;
+
+    GUI_ASSERTPARAMS(asset != NULL && path != NULL);
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return 0;
+    }
+    if (fstat(fd, &st) < 0 || st.st_size <= 0) {
+        close(fd);
+        return 0;
+    }
+    map = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);                                      /* Mapping stays valid after close */
+    if (map == MAP_FAILED) {
+        return 0;
+    }
+    if (!gui_asset_load(asset, map, (size_t)st.st_size)) {
+        munmap(map, (size_t)st.st_size);
+        return 0;
+    }
+    asset->map = map;
+    asset->map_len = (size_t)st.st_size;
+    return 1;
+}
+
+#endif /* GUI_CFG_ASSET_MMAP || __DOXYGEN__ */
+
+/**
+ * \brief           Unload asset and release its memory
+ *
+ *                  Cached glyphs or decoded image of asset are removed from caches
+ *
+ * \note            Widgets must not use asset font or image after this function
+ * \param[in]       asset: Asset to unload
+ */
+void
+gui_asset_unload(gui_asset_t* asset) {
+    if (asset == NULL) {
+        return;
+    }
+    if (asset->type == GUI_ASSET_TYPE_FONT) {
+        gui_text_removecache(&asset->font);
+    }
+#if GUI_CFG_USE_IMAGE_CACHE
+    if (asset->type == GUI_ASSET_TYPE_IMAGE) {
+        gui_imagecache_remove(&asset->image);
+    }
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+    if (asset->tables != NULL) {
+        GUI_MEMFREE(asset->tables);
+    }
+    if (asset->data != NULL) {
+        GUI_MEMFREE(asset->data);
+    }
+#if GUI_CFG_ASSET_MMAP
+    if (asset->map != NULL) {
+        munmap(asset->map, asset->map_len);
+    }
+#endif /* GUI_CFG_ASSET_MMAP */
+    memset(asset, 0x00, sizeof(*asset));
+}
+
+/**
+ * \brief           Get font of loaded asset
+ * \param[in]       asset: Loaded asset
+ * \return          Font to use with text functions, `NULL` when asset is not font
+ */
+const gui_font_t *
+gui_asset_getfont(const gui_asset_t* asset) {
+    GUI_ASSERTPARAMS(asset != NULL);
+    return asset->type == GUI_ASSET_TYPE_FONT ? &asset->font : NULL;
+}
+
+/**
+ * \brief           Get image descriptor of loaded asset
+ * \param[in]       asset: Loaded asset
+ * \return          Image descriptor to use with image widget, `NULL` when asset is not image
+ */
+const gui_image_desc_t *
+gui_asset_getimage(const gui_asset_t* asset) {
+    GUI_ASSERTPARAMS(asset != NULL);
+    return asset->type == GUI_ASSET_TYPE_IMAGE ? &asset->image : NULL;
+}
+
+#endif /* GUI_CFG_USE_ASSET || __DOXYGEN__ */
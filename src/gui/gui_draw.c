@@ -64,6 +64,7 @@ typedef struct {
     gui_dim_t charswidth;                           /*!< Width of characters after last space detected */
     const gui_char* charsptr;                       /*!< Pointer to chars start sequence */
 
+    const gui_font_char_t* lastc;                   /*!< Previous character on line, used for kerning */
     uint8_t islinefeed;                             /*!< Status indicating character is line feed */
     uint8_t isfinal;                                /*!< Status indicating we should do line check and finish */
 } gui_stringrectvars_t;
@@ -75,6 +76,31 @@ typedef struct {
 
 static gui_stringrectvars_t var;
 
+/* Number of characters decoded at once with bulk string decoder */
+#define TEXT_DECODE_COUNT       16
+
+/**
+ * \brief           Get width of character including kerning with previous character on line
+ * \param[in]       font: Font used for character
+ * \param[in]       ch: Unicode decoded character
+ * \param[in,out]   prev: Previous character on line, set to current character on return
+ * \return          Character width in units of pixels
+ */
+static gui_dim_t
+text_char_width(const gui_font_t* font, uint32_t ch, const gui_font_char_t** prev) {
+    const gui_font_char_t* c;
+    gui_dim_t w = 0;
+
+    if (font->kerning == NULL) {                    /* Width from advance table is enough without kerning */
+        return gui_text_getadvance(font, ch);
+    }
+    if ((c = gui_text_getchardesc(font, ch)) != NULL) { /* Unknown characters are not drawn */
+        w = c->x_size + c->x_margin + gui_text_getkerning(font, *prev, c);
+        *prev = c;
+    }
+    return w;
+}
+
 /* Get string rectangle width and height */
 #define RECT_CONTINUE(incCnt)     if (1) {          \
     if (incCnt) var.cnt++;                          \
@@ -158,10 +184,12 @@ process_string_rectangle_before_return(gui_stringrectvars_t* var, gui_stringrect
  */
 static size_t
 string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLine) {
-    gui_dim_t w, h, mW = 0, tH = 0;                /* Maximal width and total height */
+    gui_dim_t w, mW = 0, tH = 0;                   /* Maximal width and total height */
     uint8_t i;
     const gui_char* lastS;
     gui_string_t tmpStr;
+    uint32_t chs[TEXT_DECODE_COUNT];
+    size_t n, k;
 
     memset(&var, 0x00, sizeof(var));                /* Reset structure */
     memcpy(&var.s, str, sizeof(*str));              /* Copy memory */
@@ -219,7 +247,7 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
                     var.spacecount++;               /* Increase number of spaces on last element */
                 } else {                            /* Try to get character size */
                     /* Try to fit character in current line */
-                    gui_text_getcharsize(rect->Font, var.ch, &w, &h);   /* Get character dimensions */
+                    w = text_char_width(rect->Font, var.ch, &var.lastc);    /* Get character width */
                     if ((var.cW + w) < rect->StringDraw->width) {   /* Do we have enough memory available */
                         var.cW += w;                /* Increase total line width */
                         if (CH_WS == var.ch) {      /* Check if character is white space */
@@ -267,15 +295,19 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
         rect->width = mW;                           /* Save rectangle width */
     } else {
         var.cW = 0;
-        while (gui_string_getch(&var.s, &var.ch, &i)) { /* Get next character from string */
-            gui_text_getcharsize(rect->Font, var.ch, &w, &h);   /* Get character width and height */
-            if (!(rect->StringDraw->flags & GUI_FLAG_TEXT_RIGHTALIGN) && (var.cW + w) > rect->StringDraw->width) {  /* Check if end now */
-                break;
-            }
-            if (CH_CR != var.ch && CH_LF != var.ch) {
-                var.cW += w;                        /* Increase width */
+        while (!var.isfinal && (n = gui_string_getchs(&var.s, chs, GUI_COUNT_OF(chs))) > 0) {
+            for (k = 0; k < n; k++) {
+                var.ch = chs[k];
+                w = text_char_width(rect->Font, var.ch, &var.lastc);    /* Get character width */
+                if (!(rect->StringDraw->flags & GUI_FLAG_TEXT_RIGHTALIGN) && (var.cW + w) > rect->StringDraw->width) {  /* Check if end now */
+                    var.isfinal = 1;
+                    break;
+                }
+                if (CH_CR != var.ch && CH_LF != var.ch) {
+                    var.cW += w;                    /* Increase width */
+                }
+                var.cnt++;                          /* Increase number of characters to read */
             }
-            var.cnt++;                              /* Increase number of characters to read */
         }
         rect->ReadTotal = rect->ReadDraw = var.cnt; /* Set values for drawing and reading */
         rect->width = var.cW;                       /* Save width value */
@@ -285,184 +317,1050 @@ string_rectangle(gui_stringrect_t* rect, gui_string_t* str, uint8_t onlyToNextLi
     return var.cnt;                                 /* Return number of characters to read in current line */
 }
 
+#if GUI_CFG_USE_DITHER
+
+/* 4x4 Bayer matrix with ordered dither thresholds in range 0..15 */
+static const uint8_t dither_bayer[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
+#define DITHER_T(x, y)              dither_bayer[(y) & 0x03][(x) & 0x03]
+
+#else /* GUI_CFG_USE_DITHER */
+
+#define DITHER_T(x, y)              0
+
+#endif /* !GUI_CFG_USE_DITHER */
+
+/* Pack RGB888 to RGB565, t is ordered dither threshold for pixel (always 0 when dither is disabled) */
+static uint16_t
+rgb565_pack(uint32_t r, uint32_t g, uint32_t b, uint8_t t) {
+#if GUI_CFG_USE_DITHER
+    r = GUI_MIN(r + (t >> 1), 0xFF);                /* Offset within lost 3 bits */
+    g = GUI_MIN(g + (t >> 2), 0xFF);                /* Offset within lost 2 bits */
+    b = GUI_MIN(b + (t >> 1), 0xFF);
+#else /* GUI_CFG_USE_DITHER */
+    GUI_UNUSED(t);
+#endif /* !GUI_CFG_USE_DITHER */
+    return (uint16_t)(((r << 8) & 0xF800) | ((g << 3) & 0x07E0) | (b >> 3));
+}
+
+/* Blend ARGB8888 color with existing destination pixel */
+static void
+image_blend_pixel(uint8_t* dst, gui_color_t c, uint8_t t) {
+    uint32_t a = (c >> 24) & 0xFF, ia = 0xFF - a, d, r, g, b;
+
+    if (GUI.lcd.pixel_size == 2) {
+        d = *(uint16_t *)dst;
+        r = ((d >> 8) & 0xF8) | ((d >> 13) & 0x07);
+        g = ((d >> 3) & 0xFC) | ((d >> 9) & 0x03);
+        b = ((d << 3) & 0xF8) | ((d >> 2) & 0x07);
+    } else {
+        d = *(uint32_t *)dst;
+        r = (d >> 16) & 0xFF;
+        g = (d >> 8) & 0xFF;
+        b = d & 0xFF;
+    }
+    r = (((c >> 16) & 0xFF) * a + r * ia) / 0xFF;
+    g = (((c >> 8) & 0xFF) * a + g * ia) / 0xFF;
+    b = ((c & 0xFF) * a + b * ia) / 0xFF;
+    if (GUI.lcd.pixel_size == 2) {
+        *(uint16_t *)dst = rgb565_pack(r, g, b, t);
+    } else {
+        *(uint32_t *)dst = (d & 0xFF000000UL) | (r << 16) | (g << 8) | b;
+    }
+}
+
+/* Write ARGB8888 color to destination pixel in drawing layer, with blending when not opaque */
+static void
+image_put_pixel(uint8_t* dst, gui_color_t c, uint8_t t) {
+    if ((c >> 24) == 0xFF) {
+        if (GUI.lcd.pixel_size == 2) {
+            *(uint16_t *)dst = rgb565_pack((c >> 16) & 0xFF, (c >> 8) & 0xFF, c & 0xFF, t);
+        } else {
+            *(uint32_t *)dst = c;
+        }
+    } else if (c >> 24) {
+        image_blend_pixel(dst, c, t);
+    }
+}
+
+/* Get pointer to layer memory for absolute screen coordinate */
+static uint8_t *
+layer_get_pointer(gui_dim_t x, gui_dim_t y) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    return (uint8_t *)layer->start_address + GUI.lcd.pixel_size * ((y - layer->y_pos) * layer->width + (x - layer->x_pos));
+}
+
+/* Wait for low-level driver before writing to layer memory with software */
+static void
+layer_wait_ready(void) {
+    if (GUI.ll.IsReady != NULL) {
+        while (!GUI.ll.IsReady(&GUI.lcd));
+    }
+}
+
+/* Clip rectangle to drawing area, returns 0 when nothing is visible */
+static uint8_t
+draw_clip(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height,
+        gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
+    *x1 = GUI_MAX(x, disp->x1);
+    *y1 = GUI_MAX(y, disp->y1);
+    *x2 = GUI_MIN(x + width, disp->x2);
+    *y2 = GUI_MIN(y + height, disp->y2);
+    return *x1 < *x2 && *y1 < *y2;
+}
+
+/* Exact division by 255 for values up to 255 * 255 */
+#define DIV255(x)                   (((x) + ((x) >> 8) + 1) >> 8)
+
+/* Check 4 alpha values at once, glyph lines are mostly empty between strokes */
+static uint32_t
+alpha_quad(const uint8_t* alpha) {
+    uint32_t q;
+    memcpy(&q, alpha, sizeof(q));                   /* Alpha map lines are not aligned */
+    return q;
+}
+
+/* Blend line of character alpha values with color directly to drawing layer, x and y are absolute coordinates of first pixel */
+static void
+draw_alpha_row(uint8_t* dst, const uint8_t* alpha, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_color_t color) {
+    uint32_t cr = (color >> 16) & 0xFF, cg = (color >> 8) & 0xFF, cb = color & 0xFF, a, ia, d, r, g, b;
+    gui_dim_t i;
+
+#if !GUI_CFG_USE_DITHER
+    GUI_UNUSED(x);
+    GUI_UNUSED(y);
+#endif /* !GUI_CFG_USE_DITHER */
+    if (GUI.lcd.pixel_size == 2) {
+        uint16_t* p = (uint16_t *)dst;
+        for (i = 0; i < width; i++) {
+            a = alpha[i];
+            if (a == 0) {
+                if (i + 4 <= width && alpha_quad(&alpha[i]) == 0) {
+                    i += 3;
+                }
+            } else if (a == 0xFF) {
+                p[i] = rgb565_pack(cr, cg, cb, DITHER_T(x + i, y));
+            } else {
+                ia = 0xFF - a;
+                d = p[i];
+                r = ((d >> 8) & 0xF8) | ((d >> 13) & 0x07);
+                g = ((d >> 3) & 0xFC) | ((d >> 9) & 0x03);
+                b = ((d << 3) & 0xF8) | ((d >> 2) & 0x07);
+                r = cr * a + r * ia;
+                g = cg * a + g * ia;
+                b = cb * a + b * ia;
+                p[i] = rgb565_pack(DIV255(r), DIV255(g), DIV255(b), DITHER_T(x + i, y));
+            }
+        }
+    } else {
+        uint32_t* p = (uint32_t *)dst, crb = color & 0x00FF00FFUL, rb;
+        for (i = 0; i < width; i++) {
+            a = alpha[i];
+            if (a == 0) {
+                if (i + 4 <= width && alpha_quad(&alpha[i]) == 0) {
+                    i += 3;
+                }
+            } else if (a == 0xFF) {
+                p[i] = color;
+            } else {
+                /* Red and blue are blended together, each has 16 bits of space in 32-bit value */
+                ia = 0xFF - a;
+                d = p[i];
+                rb = crb * a + (d & 0x00FF00FFUL) * ia;
+                g = cg * a + ((d >> 8) & 0xFF) * ia;
+                rb = ((rb + ((rb >> 8) & 0x00FF00FFUL) + 0x00010001UL) >> 8) & 0x00FF00FFUL;
+                p[i] = (d & 0xFF000000UL) | rb | (DIV255(g) << 8);
+            }
+        }
+    }
+}
+
+/* Draw visible part of character line, alpha points to value of first visible pixel at x1 */
+static void
+draw_char_row(const gui_draw_text_t* draw, const uint8_t* alpha, gui_dim_t x1, gui_dim_t split, gui_dim_t x2, gui_dim_t y) {
+    if (split > x1) {
+        draw_alpha_row(layer_get_pointer(x1, y), alpha, x1, y, split - x1, draw->color1);
+    }
+    if (x2 > split) {
+        draw_alpha_row(layer_get_pointer(split, y), alpha + (split - x1), split, y, x2 - split, draw->color2);
+    }
+}
+
+#if GUI_CFG_USE_TEXT_LINE || (GUI_CFG_USE_TEXT_LAYOUT && GUI_CFG_USE_TEXT_RUN)
+
+/* Draw text alpha map, split to both text colors and clipped to text area */
+static void
+text_draw_alphamask(const gui_display_t* disp, const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const uint8_t* map) {
+    gui_display_t part;
+    gui_dim_t split = draw->x + draw->color1width;
+
+    part = *disp;
+    part.y2 = GUI_MIN(part.y2, draw->y + draw->height); /* Characters are clipped to text area */
+    part.x2 = GUI_MIN(part.x2, split);
+    gui_draw_alphamask(&part, x, y, width, height, map, draw->color1);
+    part.x1 = GUI_MAX(disp->x1, split);
+    part.x2 = disp->x2;
+    gui_draw_alphamask(&part, x, y, width, height, map, draw->color2);
+}
+
+#endif /* GUI_CFG_USE_TEXT_LINE || (GUI_CFG_USE_TEXT_LAYOUT && GUI_CFG_USE_TEXT_RUN) */
+
+#if GUI_CFG_USE_TEXT_LINE
+
+/**
+ * \brief           Text line composition state
+ */
+typedef struct {
+    uint8_t active;                                 /*!< Status indicating characters are added to line buffer */
+    gui_dim_t x, y, width, height;                  /*!< Line box, characters must be completely inside to be added */
+    gui_dim_t x1, y1, x2, y2;                       /*!< Visible part of line box, stored in line buffer */
+} text_line_t;
+
+static text_line_t text_line;
+static uint8_t text_line_buff[GUI_CFG_TEXT_LINE_SIZE];
+
+/* Start line composition, width is line width and height is taken from font size */
+static void
+text_line_begin(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t y, gui_dim_t width) {
+    text_line_t* l = &text_line;
+
+    l->x = x;
+    l->y = y;
+    l->width = width;
+    l->height = font->size;
+    l->active = draw_clip(disp, x, y, width, font->size, &l->x1, &l->y1, &l->x2, &l->y2);
+    l->y2 = GUI_MIN(l->y2, draw->y + draw->height); /* Do not draw outside text area */
+    if (GUI.ll.CopyChar == NULL || !l->active || l->y1 >= l->y2
+        || (size_t)(l->x2 - l->x1) * (size_t)(l->y2 - l->y1) > sizeof(text_line_buff)) {
+        l->active = 0;                              /* Characters are drawn one by one, software blit gains nothing from composition */
+        return;
+    }
+    layer_wait_ready();                             /* Previous line may still be read from buffer */
+    memset(text_line_buff, 0x00, (size_t)(l->x2 - l->x1) * (size_t)(l->y2 - l->y1));
+}
+
+/* Add character to line buffer, x and y are top left coordinates of character, returns 0 when character must be drawn directly */
+static uint8_t
+text_line_put(const gui_font_t* font, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c) {
+    text_line_t* l = &text_line;
+    const uint8_t* map;
+    size_t stride;
+    gui_dim_t x1, y1, x2, y2;
+
+    if (!l->active || x < l->x || y < l->y || (x + c->x_size) > (l->x + l->width) || (y + c->y_size) > (l->y + l->height)) {
+        return 0;
+    }
+    x1 = GUI_MAX(x, l->x1);                         /* Visible part of character */
+    y1 = GUI_MAX(y, l->y1);
+    x2 = GUI_MIN(x + c->x_size, l->x2);
+    y2 = GUI_MIN(y + c->y_size, l->y2);
+    if (x1 >= x2 || y1 >= y2) {
+        return 1;
+    }
+    if ((map = gui_text_getcharmap(font, c, &stride)) == NULL) {
+        return 0;
+    }
+    gui_text_combinealpha(text_line_buff + (size_t)(y1 - l->y1) * (l->x2 - l->x1) + (x1 - l->x1), l->x2 - l->x1,
+        map + (size_t)(y1 - y) * stride + (x1 - x), stride, x2 - x1, y2 - y1);
+    return 1;
+}
+
+/* Draw composed line with single blending operation per color */
+static void
+text_line_end(const gui_display_t* disp, const gui_draw_text_t* draw) {
+    text_line_t* l = &text_line;
+
+    if (l->active) {
+        l->active = 0;
+        text_draw_alphamask(disp, draw, l->x1, l->y1, l->x2 - l->x1, l->y2 - l->y1, text_line_buff);
+    }
+}
+
+#endif /* GUI_CFG_USE_TEXT_LINE */
+
 /* Draw character to screen */
 /* X and Y coordinates are TOP LEFT coordinates for character */
 static void
 draw_char(const gui_display_t* disp, const gui_font_t* font, const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t y, const gui_font_char_t* c) {
-    uint8_t i, b, k, columns;
-    gui_dim_t x1;
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_font_rle_t rle;
+    const uint8_t* ptr;
+    uint8_t row[0x100];
+    gui_dim_t x1, y1, x2, y2, split, i;
+    size_t stride;
+
+    y += c->y_pos;                                  /* Set Y position */
+#if GUI_CFG_USE_TEXT_LINE
+    if (text_line_put(font, x, y, c)) {             /* Character is drawn with entire line */
+        return;
+    }
+#endif /* GUI_CFG_USE_TEXT_LINE */
+    if (!draw_clip(disp, x, y, c->x_size, c->y_size, &x1, &y1, &x2, &y2)) {
+        return;
+    }
+    y2 = GUI_MIN(y2, draw->y + draw->height);       /* Do not draw outside text area */
+    if (y1 >= y2) {
+        return;
+    }
+    split = GUI_MAX(GUI_MIN(draw->x + draw->color1width, x2), x1);  /* Color switch position */
+
+    /* Glyph cache waits for previous copy before it frees any entry, new glyph is decoded meanwhile */
+    ptr = gui_text_getcharmap(font, c, &stride);    /* Get alpha map from font atlas or glyph cache */
+    layer_wait_ready();                             /* Wait till ready */
+    if (ptr != NULL) {                              /* We have valid data */
+        ptr += (size_t)(y1 - y) * stride + (x1 - x);    /* Skip invisible part of character */
+
+        if (GUI.ll.CopyChar != NULL) {              /* If copying character function exists in low-level part */
+            if (split > x1) {
+                GUI.ll.CopyChar(&GUI.lcd, layer, layer_get_pointer(x1, y1), ptr,
+                    split - x1, y2 - y1,
+                    layer->width - (split - x1), stride - (split - x1), draw->color1);
+            }
+            if (x2 > split) {
+                GUI.ll.CopyChar(&GUI.lcd, layer, layer_get_pointer(split, y1), ptr + (split - x1),
+                    x2 - split, y2 - y1,
+                    layer->width - (x2 - split), stride - (x2 - split), draw->color2);
+            }
+        } else {                                    /* Built-in blit, line by line from alpha map */
+            for (i = y1; i < y2; i++, ptr += stride) {
+                draw_char_row(draw, ptr, x1, split, x2, i);
+            }
+        }
+        return;
+    }
+
+    /* Character does not fit to glyph cache, decode it line by line */
+    if (font->flags & GUI_FLAG_FONT_RLE) {
+        gui_text_rle_init(&rle, font, c);
+    }
+
+    /* Lines of run-length encoded character can only be decoded in sequence */
+    for (i = (font->flags & GUI_FLAG_FONT_RLE) ? y : y1; i < y2; i++) {
+        gui_text_getcharrow(font, c, &rle, (uint8_t)(i - y), row);
+        if (i >= y1) {
+            draw_char_row(draw, &row[x1 - x], x1, split, x2, i);
+        }
+    }
+}
+
+/* Get string pointer start address for specific width of rectangle */
+static const gui_char *
+string_get_pointer_for_width(const gui_font_t* font, gui_string_t* str, gui_draw_text_t* draw) {
+    gui_dim_t tot = 0, w;
+    uint8_t i;
+    uint32_t ch;
+    const gui_char* tmp = str->str;                 /* Set start of string */
+    const gui_font_char_t *c, *next = NULL;
     
-    while (!GUI.ll.IsReady(&GUI.lcd));              /* Wait till ready */
+    gui_string_gotoend(str);                        /* Go to the end of string */
     
-    y += c->y_pos;                                  /* Set Y position */
+    while (str->str >= tmp) {
+        if (!gui_string_getchreverse(str, &ch, &i)) {   /* Get character in reverse order */
+            break;
+        }
+        w = 0;
+        if (font->kerning == NULL) {
+            w = gui_text_getadvance(font, ch);
+        } else if ((c = gui_text_getchardesc(font, ch)) != NULL) {
+            w = c->x_size + c->x_margin + gui_text_getkerning(font, c, next);   /* Kerning with character on the right */
+            next = c;
+        }
+        if ((tot + w) < draw->width) {
+            tot += w;
+        } else {
+            draw->x += draw->width - tot;           /* Add X position to align right */
+            break;
+        }
+    }
+    return str->str + i + 1;
+}
+
+/* Get top Y position of text with specific height in drawing rectangle */
+static gui_dim_t
+text_get_y(const gui_draw_text_t* draw, gui_dim_t height) {
+    gui_dim_t y = draw->y;                          /* Get start Y position */
     
-    if (!GUI_RECT_MATCH(
-        disp->x1, disp->y1, disp->x2, disp->y2,
-        x, y, x + c->x_size, y + c->y_size
-    )) {
+    if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_CENTER) { /* Check for vertical align center */
+        y += (draw->height - height) / 2;           /* Align center of drawing area */
+    } else if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_BOTTOM) {  /* Check for vertical align bottom */
+        y += draw->height - height;                 /* Align bottom of drawing area */
+    }
+    
+    if (y < draw->y) {
+        y = draw->y;
+    }
+    y -= draw->scrolly;                             /* Go scroll top */
+    
+    /* Check Y start value in case of edit mode = allow always on bottom */
+    if ((draw->flags & GUI_FLAG_TEXT_MULTILINE) && (draw->flags & GUI_FLAG_TEXT_EDITMODE)) {   /* In multi-line and edit mode */
+        if (height > draw->height) {                /* If text is greater than visible area in edit mode, set it to bottom align */
+            y = draw->y + draw->height - height;
+        }
+    }
+    return y;
+}
+
+/* Get left X position of text line with specific width in drawing rectangle */
+static gui_dim_t
+text_get_x(const gui_draw_text_t* draw, gui_dim_t x, gui_dim_t width) {
+    if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_CENTER) { /* Check for horizontal align center */
+        x += (draw->width - width) / 2;             /* Align center of drawing area */
+    } else if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_RIGHT) {   /* Check for horizontal align right */
+        x += draw->width - width;                   /* Align right of drawing area */
+    }
+    return x;
+}
+
+#if GUI_CFG_USE_TEXT_LAYOUT
+
+/* Get FNV-1a hash and length of string */
+static uint32_t
+text_layout_hash(const gui_char* str, size_t* len) {
+    const gui_char* s;
+    uint32_t hash = 0x811C9DC5UL;
+    
+    for (s = str; *s; s++) {
+        hash = (hash ^ (uint8_t)*s) * 0x01000193UL;
+    }
+    *len = (size_t)(s - str);
+    return hash;
+}
+
+/* Add new line to text layout */
+static uint8_t
+text_layout_addline(gui_text_layout_t* l, size_t offset, size_t read, size_t draw, gui_dim_t width) {
+    gui_text_layout_line_t* line;
+    
+    if (l->count == l->size) {                      /* Array is full */
+        size_t size = l->size ? 2 * l->size : 4;
+        
+        line = GUI_MEMREALLOC(l->lines, size * sizeof(*line));
+        if (line == NULL) {
+            return 0;
+        }
+        GUI_MEMTAG(line, GUI_MEM_TAG_TEXT);
+        l->lines = line;
+        l->size = size;
+    }
+    line = &l->lines[l->count++];
+    line->offset = offset;
+    line->read = read;
+    line->draw = draw;
+    line->width = width;
+    return 1;
+}
+
+/* Get text layout for string, calculate it again when string, font or drawing setup changed */
+static uint8_t
+text_layout_get(gui_text_layout_t* l, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw) {
+    gui_stringrect_t rect = {0};
+    gui_string_t currStr;
+    size_t len, cnt, k;
+    uint32_t hash, ch;
+    uint8_t i;
+    gui_dim_t x;
+    
+    hash = text_layout_hash(str, &len);
+    if (l->valid && l->str == str && l->len == len && l->hash == hash && l->font == font
+        && l->boxwidth == draw->width && l->lineheight == draw->lineheight && l->flags == draw->flags) {
+        return 1;                                   /* Layout is up to date */
+    }
+    
+    l->valid = 0;
+#if GUI_CFG_USE_TEXT_RUN
+    if (l->run != NULL) {                           /* Pre-rendered text is not valid anymore */
+        GUI_MEMFREE(l->run);
+    }
+    l->run_failed = 0;
+#endif /* GUI_CFG_USE_TEXT_RUN */
+    l->str = str;
+    l->len = len;
+    l->hash = hash;
+    l->font = font;
+    l->boxwidth = draw->width;
+    l->lineheight = draw->lineheight;
+    l->flags = draw->flags;
+    l->start = 0;
+    l->xoffset = 0;
+    l->count = 0;
+    
+    rect.Font = font;
+    rect.StringDraw = draw;
+    rect.IsEditMode = (draw->flags & GUI_FLAG_TEXT_EDITMODE) == GUI_FLAG_TEXT_EDITMODE;
+    
+    gui_string_prepare(&currStr, str);
+    string_rectangle(&rect, &currStr, 0);           /* Get string size for this box */
+    l->height = rect.height;
+    if (rect.width > draw->width && (draw->flags & GUI_FLAG_TEXT_RIGHTALIGN)) {
+        x = draw->x;
+        gui_string_prepare(&currStr, str);
+        l->start = (size_t)(string_get_pointer_for_width(font, &currStr, draw) - str);
+        l->xoffset = draw->x - x;                   /* Save alignment and restore drawing position */
+        draw->x = x;
+    }
+    
+    /* Save all lines, the same way as they are drawn */
+    gui_string_prepare(&currStr, str + l->start);
+    while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
+        if (!text_layout_addline(l, (size_t)(currStr.str - str), cnt, rect.ReadDraw, rect.width)) {
+            return 0;
+        }
+        for (k = 0; k < cnt && gui_string_getch(&currStr, &ch, &i); k++) {}
+        if (!(draw->flags & GUI_FLAG_TEXT_MULTILINE)) {
+            break;
+        }
+    }
+    l->valid = 1;
+    return 1;
+}
+
+/* Draw text with calculated layout, only visible lines are processed */
+static void
+text_layout_draw(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, const gui_draw_text_t* draw, const gui_text_layout_t* l) {
+    const gui_text_layout_line_t* line;
+    const gui_font_char_t *c, *prev;
+    gui_string_t currStr;
+    gui_dim_t x, y;
+    uint32_t ch;
+    size_t n, k;
+    uint8_t i;
+    
+    y = text_get_y(draw, l->height);
+    for (n = 0, line = l->lines; n < l->count; n++, line++) {
+        if ((y + GUI_MAX(draw->lineheight, font->size)) >= disp->y1) {  /* Skip lines above visible area */
+            x = text_get_x(draw, draw->x, line->width);
+            prev = NULL;
+#if GUI_CFG_USE_TEXT_LINE
+            text_line_begin(disp, font, draw, x, y, line->width);
+#endif /* GUI_CFG_USE_TEXT_LINE */
+            gui_string_prepare(&currStr, str + line->offset);
+            for (k = 0; k < line->draw && gui_string_getch(&currStr, &ch, &i); k++) {
+                ch = get_char_from_value(ch);       /* Get char from char value */
+                if ((c = gui_text_getchardesc(font, ch)) == NULL) {
+                    continue;                       /* Character is not known */
+                }
+                x += gui_text_getkerning(font, prev, c);    /* Apply kerning with previous character */
+                prev = c;
+                if (x > disp->x2) {                 /* Rest of line is not visible */
+                    break;
+                }
+                draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
+                x += c->x_size + c->x_margin;       /* Increase X position */
+            }
+#if GUI_CFG_USE_TEXT_LINE
+            text_line_end(disp, draw);
+#endif /* GUI_CFG_USE_TEXT_LINE */
+        }
+        y += draw->lineheight;                      /* Go to next line */
+        if (y > disp->y2) {                         /* Over visible Y area */
+            break;
+        }
+    }
+}
+
+#if GUI_CFG_USE_TEXT_RUN
+
+/*
+ * Process every drawn character of layout with its position relative to text start position.
+ * When alpha map is set, characters are rendered to it, otherwise only bounding box is calculated
+ */
+static void
+text_run_process(const gui_font_t* font, const gui_char* str, const gui_draw_text_t* draw, gui_text_layout_t* l, uint8_t* map) {
+    const gui_text_layout_line_t* line;
+    const gui_font_char_t *c, *prev;
+    gui_string_t currStr;
+    gui_dim_t x, y, x1 = 0, y1 = 0, x2 = 0, y2 = 0;
+    uint32_t ch;
+    size_t n, k;
+    uint8_t i;
+    
+    for (n = 0, y = 0, line = l->lines; n < l->count; n++, line++, y += draw->lineheight) {
+        x = text_get_x(draw, 0, line->width);
+        prev = NULL;
+        gui_string_prepare(&currStr, str + line->offset);
+        for (k = 0; k < line->draw && gui_string_getch(&currStr, &ch, &i); k++) {
+            if ((c = gui_text_getchardesc(font, get_char_from_value(ch))) == NULL) {
+                continue;
+            }
+            x += gui_text_getkerning(font, prev, c);
+            prev = c;
+            if (map != NULL) {
+                gui_text_getcharalpha(font, c, map + (size_t)(y + c->y_pos - l->run_y) * l->run_width + (x - l->run_x), l->run_width);
+            } else if (c->x_size && c->y_size) {
+                if (x1 == x2) {                     /* First character sets initial bounding box */
+                    x1 = x;
+                    y1 = y + c->y_pos;
+                    x2 = x + c->x_size;
+                    y2 = y + c->y_pos + c->y_size;
+                }
+                x1 = GUI_MIN(x1, x);
+                y1 = GUI_MIN(y1, y + c->y_pos);
+                x2 = GUI_MAX(x2, x + c->x_size);
+                y2 = GUI_MAX(y2, y + c->y_pos + c->y_size);
+            }
+            x += c->x_size + c->x_margin;
+        }
+    }
+    if (map == NULL) {
+        l->run_x = x1;
+        l->run_y = y1;
+        l->run_width = x2 - x1;
+        l->run_height = y2 - y1;
+    }
+}
+
+/* Get pre-rendered alpha map of text, render it when not available yet */
+static uint8_t
+text_run_get(const gui_font_t* font, const gui_char* str, const gui_draw_text_t* draw, gui_text_layout_t* l) {
+    size_t size;
+    
+    if (l->run != NULL && l->run_align == (draw->align & GUI_HALIGN_MASK)) {
+        return 1;
+    }
+    if (l->run != NULL) {                           /* Horizontal alignment changed */
+        GUI_MEMFREE(l->run);
+        l->run_failed = 0;
+    }
+    if (l->run_failed) {                            /* Do not try again until layout changes */
+        return 0;
+    }
+    
+    text_run_process(font, str, draw, l, NULL);     /* Get bounding box of all characters */
+    size = (size_t)l->run_width * (size_t)l->run_height;
+    if (size == 0 || size > GUI_CFG_TEXT_RUN_MAX_SIZE || (l->run = GUI_MEMALLOC(size)) == NULL) {
+        l->run_failed = 1;
+        return 0;
+    }
+    GUI_MEMTAG(l->run, GUI_MEM_TAG_TEXT);
+    l->run_align = draw->align & GUI_HALIGN_MASK;
+    text_run_process(font, str, draw, l, l->run);
+    return 1;
+}
+
+/* Draw pre-rendered text, pixels left to color split position use first color */
+static void
+text_run_draw(const gui_display_t* disp, const gui_draw_text_t* draw, const gui_text_layout_t* l) {
+    text_draw_alphamask(disp, draw, draw->x + l->run_x, text_get_y(draw, l->height) + l->run_y, l->run_width, l->run_height, l->run);
+}
+
+#endif /* GUI_CFG_USE_TEXT_RUN */
+
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
+
+/* Decode single pixel of 16, 24 or 32 bits per pixel image to ARGB8888 color */
+static gui_color_t
+image_decode(const uint8_t* p, uint8_t bpp) {
+    uint32_t v;
+
+    switch (bpp) {
+        case 32:
+            return ((uint32_t)(0xFF - p[3]) << 24) | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+        case 24:
+            return 0xFF000000UL | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+        case 16:
+            v = p[0] | (p[1] << 8);
+            return 0xFF000000UL
+                | ((((v << 3) & 0xF8) | ((v >> 2) & 0x07)) << 16)
+                | ((((v >> 3) & 0xFC) | ((v >> 9) & 0x03)) << 8)
+                | (((v >> 8) & 0xF8) | ((v >> 13) & 0x07));
+        default:
+            return 0;
+    }
+}
+
+/*
+ * Read image pixel as ARGB8888 color.
+ * Byte order is the one expected by low-level image functions:
+ * red and blue are swapped and 32-bit alpha channel is inverted (0 = opaque)
+ */
+static gui_color_t
+image_get_pixel(const gui_image_desc_t* img, gui_dim_t x, gui_dim_t y) {
+    const uint8_t* p;
+#if GUI_CFG_USE_IMAGE_INDEXED
+    uint32_t v;
+#endif /* GUI_CFG_USE_IMAGE_INDEXED */
+
+#if GUI_CFG_USE_IMAGE_INDEXED
+    if (img->clut != NULL) {
+        if (img->bpp == 8) {
+            v = img->image[y * img->x_size + x];
+        } else {
+            v = (img->image[y * ((img->x_size + 1) >> 1) + (x >> 1)] >> ((x & 0x01) ? 0 : 4)) & 0x0F;
+        }
+        return v < img->clut_size ? img->clut[v] : 0;
+    }
+#endif /* GUI_CFG_USE_IMAGE_INDEXED */
+    p = img->image + (y * img->x_size + x) * (img->bpp >> 3);
+    return image_decode(p, img->bpp);
+}
+
+/*
+ * Convert line of 16, 24 or 32 bits per pixel image to drawing layer, one loop per format.
+ * Image byte order is the same as in image_decode.
+ * ox and oy are absolute screen coordinates of first pixel, used for dither pattern
+ */
+static void
+image_row_sw(uint8_t* dst, const uint8_t* p, uint8_t bpp, gui_dim_t width, gui_dim_t ox, gui_dim_t oy) {
+    uint16_t* d16 = (uint16_t *)dst;
+    uint32_t* d32 = (uint32_t *)dst;
+    gui_dim_t k;
+    uint32_t v;
+
+#if !GUI_CFG_USE_DITHER
+    GUI_UNUSED(ox);
+    GUI_UNUSED(oy);
+#endif /* !GUI_CFG_USE_DITHER */
+    switch (bpp) {
+        case 32:                                    /* Alpha is inverted, 0 = opaque */
+            for (k = 0; k < width; k++, p += 4) {
+                if (p[3] == 0x00) {
+                    if (GUI.lcd.pixel_size == 2) {
+                        d16[k] = rgb565_pack(p[0], p[1], p[2], DITHER_T(ox + k, oy));
+                    } else {
+                        d32[k] = 0xFF000000UL | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+                    }
+                } else if (p[3] != 0xFF) {
+                    image_blend_pixel(dst + k * GUI.lcd.pixel_size, image_decode(p, 32), DITHER_T(ox + k, oy));
+                }
+            }
+            break;
+        case 24:
+            if (GUI.lcd.pixel_size == 2) {
+                for (k = 0; k < width; k++, p += 3) {
+                    d16[k] = rgb565_pack(p[0], p[1], p[2], DITHER_T(ox + k, oy));
+                }
+            } else {
+                for (k = 0; k < width; k++, p += 3) {
+                    d32[k] = 0xFF000000UL | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+                }
+            }
+            break;
+        case 16:
+            if (GUI.lcd.pixel_size == 2) {
+                for (k = 0; k < width; k++, p += 2) {
+#if GUI_CFG_USE_DITHER
+                    v = image_decode(p, 16);
+                    d16[k] = rgb565_pack((v >> 16) & 0xFF, (v >> 8) & 0xFF, v & 0xFF, DITHER_T(ox + k, oy));
+#else /* GUI_CFG_USE_DITHER */
+                    v = p[0] | (p[1] << 8);
+                    d16[k] = (uint16_t)(((v & 0x001F) << 11) | (v & 0x07E0) | (v >> 11));   /* Swap red and blue */
+#endif /* !GUI_CFG_USE_DITHER */
+                }
+            } else {
+                for (k = 0; k < width; k++, p += 2) {
+                    d32[k] = image_decode(p, 16);
+                }
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*
+ * Draw 16, 24 or 32 bits per pixel image with software, sx and sy are start pixel offsets in image.
+ * ox and oy are absolute screen coordinates of first pixel, used for dither pattern
+ */
+static void
+draw_image_sw(const gui_image_desc_t* img, uint8_t* dst, gui_dim_t sx, gui_dim_t sy, gui_dim_t width, gui_dim_t height, gui_dim_t offlineDst, gui_dim_t ox, gui_dim_t oy) {
+    const uint8_t* p;
+    gui_dim_t i;
+    size_t stride = (size_t)img->x_size * (img->bpp >> 3);
+    size_t dst_stride = (size_t)(width + offlineDst) * GUI.lcd.pixel_size;
+
+    p = img->image + (size_t)sy * stride + (size_t)sx * (img->bpp >> 3);
+    for (i = 0; i < height; i++, p += stride, dst += dst_stride) {
+        image_row_sw(dst, p, img->bpp, width, ox, oy + i);
+    }
+}
+
+#if GUI_CFG_USE_IMAGE_INDEXED
+
+static uint32_t image_pal[256];                     /* Palette converted to drawing layer pixel format */
+static const gui_color_t* image_pal_clut;           /* CLUT used to prepare palette */
+static uint16_t image_pal_size;                     /* Number of prepared palette entries */
+static uint8_t image_pal_pixel_size;                /* Pixel size used for palette preparation */
+
+/* Convert image CLUT to destination pixel format, only when CLUT pointer changes or gui_draw_image_clutchanged is called */
+static void
+image_prepare_palette(const gui_image_desc_t* img) {
+    uint16_t i, cnt;
+    gui_color_t c;
+
+    cnt = GUI_MIN(img->clut_size, GUI_COUNT_OF(image_pal));
+    if (image_pal_clut == img->clut && image_pal_size == cnt
+        && image_pal_pixel_size == GUI.lcd.pixel_size) {
+        return;                                     /* Palette is already prepared */
+    }
+    for (i = 0; i < cnt; i++) {
+        c = img->clut[i];
+        if (GUI.lcd.pixel_size == 2) {              /* Convert ARGB8888 to RGB565 */
+            image_pal[i] = ((c >> 8) & 0xF800) | ((c >> 5) & 0x07E0) | ((c >> 3) & 0x001F);
+        } else {
+            image_pal[i] = c;
+        }
+    }
+    image_pal_clut = img->clut;
+    image_pal_size = cnt;
+    image_pal_pixel_size = GUI.lcd.pixel_size;
+}
+
+/* Draw palette-indexed image with software, sx and sy are start pixel offsets in image */
+static void
+draw_image_indexed(const gui_image_desc_t* img, uint8_t* dst, gui_dim_t sx, gui_dim_t sy, gui_dim_t width, gui_dim_t height, gui_dim_t offlineDst) {
+    const uint8_t* row;
+    gui_dim_t i, k, px;
+    uint8_t idx, a;
+    size_t stride = img->bpp == 8 ? img->x_size : (img->x_size + 1) >> 1;
+
+    image_prepare_palette(img);                     /* Make sure palette is ready */
+    offlineDst *= GUI.lcd.pixel_size;               /* Line offset in units of bytes */
+    for (i = 0; i < height; i++, dst += offlineDst) {
+        row = img->image + (sy + i) * stride;
+        for (k = 0, px = sx; k < width; k++, px++, dst += GUI.lcd.pixel_size) {
+            if (img->bpp == 8) {
+                idx = row[px];
+            } else {
+                idx = (row[px >> 1] >> ((px & 0x01) ? 0 : 4)) & 0x0F;
+            }
+            if (idx >= image_pal_size) {            /* Invalid index is treated as transparent */
+                continue;
+            }
+            a = (uint8_t)(img->clut[idx] >> 24);
+            if (a == 0xFF) {                        /* Opaque color, copy prepared value */
+                if (GUI.lcd.pixel_size == 2) {
+                    *(uint16_t *)dst = (uint16_t)image_pal[idx];
+                } else {
+                    *(uint32_t *)dst = image_pal[idx];
+                }
+            } else if (a) {
+                image_blend_pixel(dst, img->clut[idx], 0);
+            }
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_IMAGE_INDEXED */
+
+/* Inverse mapping of transformed image, source coordinates are in 16.16 fixed point */
+typedef struct {
+    int32_t u;                                      /* Source X coordinate for center of destination pixel (0, 0) */
+    int32_t v;                                      /* Source Y coordinate for center of destination pixel (0, 0) */
+    int32_t dudx, dvdx;                             /* Source step for one destination pixel in X direction */
+    int32_t dudy, dvdy;                             /* Source step for one destination pixel in Y direction */
+    gui_dim_t width;                                /* Transformed image bounding box width */
+    gui_dim_t height;                               /* Transformed image bounding box height */
+} image_tr_map_t;
+
+/* Prepare inverse mapping for image transformation */
+static void
+image_transform_setup(const gui_image_desc_t* img, const gui_draw_image_transform_t* tr, image_tr_map_t* m) {
+    float c, s, sx, sy, a, dx, dy;
+
+    a = fmodf(tr->angle, 360.0f);
+    if (a < 0) {
+        a += 360.0f;
+    }
+    if (a == 0.0f) {                                /* Use exact values for multiples of 90 degrees */
+        c = 1.0f; s = 0.0f;
+    } else if (a == 90.0f) {
+        c = 0.0f; s = 1.0f;
+    } else if (a == 180.0f) {
+        c = -1.0f; s = 0.0f;
+    } else if (a == 270.0f) {
+        c = 0.0f; s = -1.0f;
+    } else {
+        a *= 3.14159265f / 180.0f;
+        c = cosf(a);
+        s = sinf(a);
+    }
+    sx = tr->scale_x > 0.0f ? tr->scale_x : 1.0f;
+    sy = tr->scale_y > 0.0f ? tr->scale_y : 1.0f;
+
+    /* Bounding box of transformed image */
+    m->width = (gui_dim_t)ceilf(fabsf(img->x_size * sx * c) + fabsf(img->y_size * sy * s) - 0.001f);
+    m->height = (gui_dim_t)ceilf(fabsf(img->x_size * sx * s) + fabsf(img->y_size * sy * c) - 0.001f);
+
+    /* Rotate back and unscale, relative to centers of images */
+    m->dudx = (int32_t)(c / sx * 65536.0f);
+    m->dvdx = (int32_t)(-s / sy * 65536.0f);
+    m->dudy = (int32_t)(s / sx * 65536.0f);
+    m->dvdy = (int32_t)(c / sy * 65536.0f);
+    dx = 0.5f - (float)m->width / 2.0f;
+    dy = 0.5f - (float)m->height / 2.0f;
+    m->u = (int32_t)(((c * dx + s * dy) / sx + (float)img->x_size / 2.0f) * 65536.0f);
+    m->v = (int32_t)(((-s * dx + c * dy) / sy + (float)img->y_size / 2.0f) * 65536.0f);
+}
+
+/* Floor division for signed values */
+static int32_t
+image_floordiv(int64_t a, int64_t b) {
+    int64_t q = a / b;
+    if ((a % b) != 0 && ((a < 0) != (b < 0))) {
+        q--;
+    }
+    return (int32_t)q;
+}
+
+/* Limit span [*k0, *k1) to steps where 0 <= start + k * step < lim */
+static void
+image_span_limit(int32_t start, int32_t step, int32_t lim, gui_dim_t* k0, gui_dim_t* k1) {
+    int32_t a, b;
+
+    if (step == 0) {
+        if (start < 0 || start >= lim) {
+            *k1 = *k0;                              /* Whole span is outside */
+        }
         return;
     }
-    
-    if (GUI.ll.CopyChar != NULL) {                  /* If copying character function exists in low-level part */
-        gui_font_charentry_t* entry = NULL;
-        
-        entry = gui_text_getcharentry(font, c);     /* Get char entry from font and character for fast alpha drawing operations */
-        if (entry == NULL) {
-            entry = gui_text_createcharentry(font, c);  /* Create new entry */
-        }
-        if (entry != NULL) {                        /* We have valid data */
-            gui_dim_t width, height, offlineSrc, offlineDst, tmpx;
-            uint8_t* dst = 0;
-            uint8_t* ptr = (uint8_t *)entry;        /* Get pointer */
-            
-            tmpx = x;                               /* Start X */
-            
-            ptr += sizeof(*entry);                  /* Go to start of data array */
-            dst = (uint8_t *)(((uint8_t *)GUI.lcd.drawing_layer->start_address) + ((y - GUI.lcd.drawing_layer->y_pos) * GUI.lcd.drawing_layer->width + (x - GUI.lcd.drawing_layer->x_pos)) * GUI.lcd.pixel_size);
-            
-            width = c->x_size;                      /* Get X size */
-            height = c->y_size;                     /* Get Y size */
-            
-            if (y < disp->y1) {                     /* Start Y position if outside visible area */
-                ptr += (disp->y1 - y) * c->x_size;  /* Set offset for number of lines */
-                dst += (disp->y1 - y) * GUI.lcd.drawing_layer->width * GUI.lcd.pixel_size;  /* Set offset for number of LCD lines */
-                height -= disp->y1 - y;             /* Decrease effective height */
-            }
-            if ((y + c->y_size) > disp->y2) {
-                height -= y + c->y_size - disp->y2; /* Decrease effective height */
-            }
-            if (x < disp->x1) {                     /* Set offset start address if required */
-                ptr += (disp->x1 - x);              /* Set offset of start address in X direction */
-                dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
-                width -= disp->x1 - x;              /* Increase source offline */
-                tmpx += disp->x1 - x;               /* Increase effective start X position */
-            }
-            if ((x + c->x_size) > disp->x2) {
-                width -= x + c->x_size - disp->x2;  /* Decrease effective width */
+    if (step > 0) {
+        a = -image_floordiv(start, step);           /* First k where value >= 0 */
+        b = -image_floordiv(-((int64_t)lim - start), step); /* First k where value >= lim */
+    } else {
+        a = image_floordiv((int64_t)start - lim, -step) + 1;    /* First k where value < lim */
+        b = image_floordiv(start, -step) + 1;       /* First k where value < 0 */
+    }
+    if (a > *k0) {
+        *k0 = (gui_dim_t)GUI_MIN(a, *k1);
+    }
+    if (b < *k1) {
+        *k1 = (gui_dim_t)GUI_MAX(b, *k0);
+    }
+}
+
+/* Sample image with bilinear filter, coordinates are in 16.16 fixed point at pixel center */
+static gui_color_t
+image_sample_bilinear(const gui_image_desc_t* img, int32_t u, int32_t v) {
+    gui_dim_t x0, y0, x1, y1;
+    uint32_t fx, fy, w[4], i, a, sa = 0, sr = 0, sg = 0, sb = 0;
+    gui_color_t c[4];
+
+    u -= 0x8000;                                    /* Move to top-left pixel of 2x2 block */
+    v -= 0x8000;
+    x0 = (gui_dim_t)(u >> 16);
+    y0 = (gui_dim_t)(v >> 16);
+    fx = (u >> 8) & 0xFF;
+    fy = (v >> 8) & 0xFF;
+    x1 = GUI_MIN(x0 + 1, img->x_size - 1);          /* Clamp to image edges */
+    y1 = GUI_MIN(y0 + 1, img->y_size - 1);
+    x0 = GUI_MAX(x0, 0);
+    y0 = GUI_MAX(y0, 0);
+
+    c[0] = image_get_pixel(img, x0, y0);
+    c[1] = image_get_pixel(img, x1, y0);
+    c[2] = image_get_pixel(img, x0, y1);
+    c[3] = image_get_pixel(img, x1, y1);
+    w[0] = (0x100 - fx) * (0x100 - fy);             /* Weights, sum is 0x10000 */
+    w[1] = fx * (0x100 - fy);
+    w[2] = (0x100 - fx) * fy;
+    w[3] = fx * fy;
+
+    /* Interpolate with premultiplied alpha to prevent dark edges */
+    for (i = 0; i < 4; i++) {
+        a = (c[i] >> 24) * w[i];
+        sa += a;
+        a >>= 8;
+        sr += ((c[i] >> 16) & 0xFF) * a;
+        sg += ((c[i] >> 8) & 0xFF) * a;
+        sb += (c[i] & 0xFF) * a;
+    }
+    if (sa < 0x10000) {
+        return 0;                                   /* Fully transparent */
+    }
+    a = sa >> 8;
+    return ((sa >> 16) << 24) | ((sr / a) << 16) | ((sg / a) << 8) | (sb / a);
+}
+
+/*
+ * Render transformed image region [x1, x2) x [y1, y2) in bounding box coordinates.
+ * Only destination pixels which map inside source image are processed.
+ * When layer is 0, ARGB8888 output is written in format of 32-bit images,
+ * otherwise ox and oy are absolute screen coordinates of bounding box, used for dither pattern
+ */
+static void
+image_transform_render(const gui_image_desc_t* img, const image_tr_map_t* m, uint8_t flags,
+        gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, uint8_t* dst, size_t stride, uint8_t layer, gui_dim_t ox, gui_dim_t oy) {
+    int32_t u, v, lu, lv;
+    gui_dim_t y, k, k0, k1;
+    uint8_t bytes = layer ? GUI.lcd.pixel_size : 4;
+    gui_color_t c;
+    uint8_t* d;
+
+#if !GUI_CFG_USE_DITHER
+    GUI_UNUSED(ox);
+    GUI_UNUSED(oy);
+#endif /* !GUI_CFG_USE_DITHER */
+    lu = (int32_t)img->x_size << 16;
+    lv = (int32_t)img->y_size << 16;
+    for (y = y1; y < y2; y++, dst += stride) {
+        u = m->u + x1 * m->dudx + y * m->dudy;      /* Source position of first pixel in row */
+        v = m->v + x1 * m->dvdx + y * m->dvdy;
+        k0 = 0;
+        k1 = x2 - x1;
+        image_span_limit(u, m->dudx, lu, &k0, &k1); /* Skip pixels outside source image */
+        image_span_limit(v, m->dvdx, lv, &k0, &k1);
+        u += k0 * m->dudx;
+        v += k0 * m->dvdx;
+        for (k = k0, d = dst + k0 * bytes; k < k1; k++, d += bytes, u += m->dudx, v += m->dvdx) {
+            if (flags & GUI_FLAG_DRAW_IMAGE_BILINEAR) {
+                c = image_sample_bilinear(img, u, v);
+            } else {
+                c = image_get_pixel(img, GUI_MIN(u >> 16, img->x_size - 1), GUI_MIN(v >> 16, img->y_size - 1));
             }
-            
-            offlineSrc = c->x_size - width;         /* Set offline source */
-            offlineDst = GUI.lcd.drawing_layer->width - width;   /* Set offline destination */
-            
-            /* Check if character must be drawn with 2 colors, on the middle of color switch */
-            if (tmpx < (draw->x + draw->color1width) && (tmpx + width) > (draw->x + draw->color1width)) {
-                gui_dim_t firstWidth = (draw->x + draw->color1width) - tmpx;
-                
-                /* First part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
-                    firstWidth, height,
-                    offlineDst + width - firstWidth, offlineSrc + width - firstWidth, draw->color1);
-                
-                /* Second part draw */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst + firstWidth * GUI.lcd.pixel_size, ptr + firstWidth, 
-                    width - firstWidth, height,
-                    offlineDst + firstWidth, offlineSrc + firstWidth, draw->color2);
+            if (layer) {
+                image_put_pixel(d, c, DITHER_T(ox + x1 + k, oy + y));
             } else {
-                /* Draw entire character with single color */
-                GUI.ll.CopyChar(&GUI.lcd, GUI.lcd.drawing_layer, dst, ptr, 
-                    width, height,
-                    offlineDst, offlineSrc, (draw->x + draw->color1width) > x ? draw->color1 : draw->color2);
+                *(uint32_t *)d = ((uint32_t)(0xFF - (c >> 24)) << 24) | ((c & 0xFF) << 16) | (c & 0xFF00) | ((c >> 16) & 0xFF);
             }
-            return;
         }
     }
-    
-    if (font->flags & GUI_FLAG_FONT_AA) {           /* Font has anti alliasing enabled */
-        gui_color_t color;                          /* Temporary color for AA */
-        uint8_t tmp, r1, g1, b1;
-        
-        columns = c->x_size / 4;                    /* Calculate number of bytes used for single character line */
-        if (c->x_size % 4) {                        /* If only 1 column used */
-            columns++;
-        }
-        
-        for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
-            if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */            
-                b = c->data[i];                     /* Get character byte */
-                for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
-                    gui_color_t baseColor;
-                    x1 = x + (i % columns) * 4 + k; /* Get new X value for pixel draw */
-                    if (x1 < disp->x1 || x1 > disp->x2) {
-                        continue;
-                    }
-                    if (x1 < (draw->x + draw->color1width)) {
-                        baseColor = draw->color1;
-                    } else {
-                        baseColor = draw->color2;
-                    }
-                    tmp = (b >> (6 - 2 * k)) & 0x03;/* Get temporary bits on bottom */
-                    if (tmp == 0x03) {              /* Draw solid color if both bits are enabled */
-                        gui_draw_setpixel(disp, x1, y, baseColor);
-                    } else if (tmp) {               /* Calculate new color */
-                        float t = (float)tmp / 3.0f;
-                        color = gui_draw_getpixel(disp, x1, y); /* Read current color */
-                        
-                        /* Calculate new values for pixel */
-                        r1 = GUI_U8((float)t * (float)((color >> 16) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >> 16) & 0xFF));
-                        g1 = GUI_U8((float)t * (float)((color >>  8) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  8) & 0xFF));
-                        b1 = GUI_U8((float)t * (float)((color >>  0) & 0xFF) + (float)(1.0f - (float)t) * (float)((baseColor >>  0) & 0xFF));
-                        
-                        /* Draw actual pixel to screen */
-                        gui_draw_setpixel(disp, x1, y, (color & 0xFF000000UL) | r1 << 16 | g1 << 8 | b1);
-                    }
-                }
-            }
-            if ((i % columns) == (columns - 1)) {   /* Check for next line */
-                y++;
-            }
-        }
+}
+
+/* Interpolate color between start and stop color, w is weight of stop color in range 0..256 */
+static gui_color_t
+gradient_mix(gui_color_t c1, gui_color_t c2, uint32_t w) {
+    uint32_t rb, ag;
+
+    /* Two channels at a time, 9-bit weight leaves enough space between them */
+    rb = ((c1 & 0x00FF00FFUL) * (0x100 - w) + (c2 & 0x00FF00FFUL) * w) >> 8;
+    ag = (((c1 >> 8) & 0x00FF00FFUL) * (0x100 - w) + ((c2 >> 8) & 0x00FF00FFUL) * w) >> 8;
+    return (rb & 0x00FF00FFUL) | ((ag & 0x00FF00FFUL) << 8);
+}
+
+/* Copy one or more full lines of width pixels within drawing layer */
+static void
+layer_copy_lines(uint8_t* dst, const uint8_t* src, gui_dim_t width, gui_dim_t lines) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    size_t stride = (size_t)layer->width * GUI.lcd.pixel_size;
+
+    if (GUI.ll.Copy != NULL) {
+        GUI.ll.Copy(&GUI.lcd, layer, dst, src, width, lines, layer->width - width, layer->width - width);
     } else {
-        columns = c->x_size / 8;
-        if (c->x_size % 8) {
-            columns++;
-        }
-        for (i = 0; i < columns * c->y_size; i++) { /* Go through all data bytes */
-            if (y >= disp->y1 && y <= disp->y2 && y < (draw->y + draw->height)) {   /* Do not draw when we are outside clipping are */
-                b = c->data[i];                     /* Get character byte */
-                for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
-                    if (b & (1 << (7 - k))) {       /* If bit is set, draw pixel */
-                        x1 = x + (i % columns) * 8 + k; /* Get new X value for pixel draw */
-                        if (x1 < disp->x1 || x1 > disp->x2) {
-                            continue;
-                        }
-                        if (x1 <= (draw->x + draw->color1width)) {
-                            gui_draw_setpixel(disp, x1, y, draw->color1);
-                        } else {
-                            gui_draw_setpixel(disp, x1, y, draw->color2);
-                        }
-                    }
-                }
-            }
-            if ((i % columns) == (columns - 1)) {   /* Check for next line */
-                y++;
-            }
+        for (; lines > 0; lines--, dst += stride, src += stride) {
+            memcpy(dst, src, (size_t)width * GUI.lcd.pixel_size);
         }
     }
 }
 
-/* Get string pointer start address for specific width of rectangle */
-static const gui_char *
-string_get_pointer_for_width(const gui_font_t* font, gui_string_t* str, gui_draw_text_t* draw) {
-    gui_dim_t tot = 0, w, h;
-    uint8_t i;
-    uint32_t ch;
-    const gui_char* tmp = str->str;                 /* Set start of string */
-    
-    gui_string_gotoend(str);                        /* Go to the end of string */
-    
-    while (str->str >= tmp) {
-        if (!gui_string_getchreverse(str, &ch, &i)) {   /* Get character in reverse order */
-            break;
-        }
-        gui_text_getcharsize(font, ch, &w, &h);
-        if ((tot + w) < draw->width) {
-            tot += w;
-        } else {
-            draw->x += draw->width - tot;           /* Add X position to align right */
-            break;
-        }
+/*
+ * Replicate first `rows` lines to all `total` lines below, doubling copied block each time.
+ * Number of rows must be multiple of dither pattern height to keep pattern continuous
+ */
+static void
+layer_replicate_lines(uint8_t* first, gui_dim_t width, gui_dim_t rows, gui_dim_t total) {
+    size_t stride = (size_t)GUI.lcd.drawing_layer->width * GUI.lcd.pixel_size;
+    gui_dim_t n;
+
+    while (rows < total) {
+        n = GUI_MIN(rows, total - rows);
+        layer_copy_lines(first + rows * stride, first, width, n);
+        rows += n;
     }
-    return str->str + i + 1;
 }
 
 /* Fill screen with color on specific coordinates */
@@ -687,12 +1585,267 @@ gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x
 
 /**
  * \brief           Draw rectangle extended function
+ * \note            Radius is not used for gradient fill
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
  * \param[in]       rect: Rectangle data
  */
 void
 gui_draw_rectangle_ex(const gui_display_t* disp, gui_draw_rect_ex_t* rect) {
+    if (rect->flags & GUI_FLAG_DRAW_FILLED) {
+        if (rect->flags & (GUI_FLAG_DRAW_GRAD_VER | GUI_FLAG_DRAW_GRAD_HOR)) {
+            gui_gradient_t grad;
+
+            grad.start = rect->color;
+            grad.stop = rect->color_end;
+            gui_draw_gradientrect(disp, rect->x, rect->y, rect->width, rect->height, &grad, rect->flags);
+        } else if (rect->radius) {
+            gui_draw_filledroundedrectangle(disp, rect->x, rect->y, rect->width, rect->height, rect->radius, rect->color);
+        } else {
+            gui_draw_filledrectangle(disp, rect->x, rect->y, rect->width, rect->height, rect->color);
+        }
+    } else if (rect->radius) {
+        gui_draw_roundedrectangle(disp, rect->x, rect->y, rect->width, rect->height, rect->radius, rect->color);
+    } else {
+        gui_draw_rectangle(disp, rect->x, rect->y, rect->width, rect->height, rect->color);
+    }
+}
+
+/**
+ * \brief           Fill rectangle with vertical or horizontal gradient
+ *
+ *                  Vertical gradient is drawn with one fill operation per line.
+ *                  For horizontal gradient, first line is generated once and copied to other lines.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       grad: Gradient colors, start color is on top or left side
+ * \param[in]       flags: Gradient direction, \ref GUI_FLAG_DRAW_GRAD_VER or \ref GUI_FLAG_DRAW_GRAD_HOR
+ * \sa              gui_draw_lineargradient, gui_draw_radialgradient
+ */
+void
+gui_draw_gradientrect(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, uint8_t flags) {
+    gui_dim_t x1, y1, x2, y2, i, k, rows;
+    uint32_t w, step, len;
+    uint8_t opaque, dither, hor = !!(flags & GUI_FLAG_DRAW_GRAD_HOR);
+    gui_color_t c;
+    uint8_t* dst;
+
+    if (grad == NULL || !draw_clip(disp, x, y, width, height, &x1, &y1, &x2, &y2)) {
+        return;
+    }
+    len = (hor ? width : height) - 1;
+    step = len ? (0x100UL << 16) / len : 0;         /* Weight step per pixel in 16.16 format */
+    opaque = (grad->start >> 24) == 0xFF && (grad->stop >> 24) == 0xFF;
+    dither = GUI_CFG_USE_DITHER && GUI.lcd.pixel_size == 2;
+
+    if (!hor && opaque && !dither) {                /* One fill operation per line */
+        for (i = y1; i < y2; i++) {
+            w = ((i - y) * step + 0x8000) >> 16;
+            gui_draw_fill(disp, x1, i, x2 - x1, 1, gradient_mix(grad->start, grad->stop, GUI_MIN(w, 0x100)));
+        }
+        return;
+    }
+
+    /* Generate lines with software; only horizontal opaque gradient can be replicated */
+    rows = y2 - y1;
+    if (hor && opaque) {
+        rows = GUI_MIN(dither ? 4 : 1, rows);       /* Generate one full dither pattern */
+    }
+    layer_wait_ready();
+    for (i = y1; i < y1 + rows; i++) {
+        dst = layer_get_pointer(x1, i);
+        c = gradient_mix(grad->start, grad->stop, GUI_MIN((((i - y) * step + 0x8000) >> 16), 0x100));
+        for (k = x1; k < x2; k++, dst += GUI.lcd.pixel_size) {
+            if (hor) {
+                c = gradient_mix(grad->start, grad->stop, GUI_MIN((((k - x) * step + 0x8000) >> 16), 0x100));
+            }
+            image_put_pixel(dst, c, DITHER_T(k, i));
+        }
+    }
+    if (rows < y2 - y1) {
+        layer_replicate_lines(layer_get_pointer(x1, y1), x2 - x1, rows, y2 - y1);
+    }
+}
+
+/**
+ * \brief           Fill rectangle with linear gradient in any direction
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       grad: Gradient colors
+ * \param[in]       angle: Gradient direction in units of degrees.
+ *                      `0` goes from left to right, `90` from top to bottom
+ * \sa              gui_draw_gradientrect, gui_draw_radialgradient
+ */
+void
+gui_draw_lineargradient(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, float angle) {
+    gui_dim_t x1, y1, x2, y2, i, k;
+    gui_gradient_t g;
+    int32_t t, dtx, dty, t0;
+    float c, s, span;
+    uint8_t* dst;
+
+    if (grad == NULL || !draw_clip(disp, x, y, width, height, &x1, &y1, &x2, &y2)) {
+        return;
+    }
+    angle = fmodf(angle, 360.0f);
+    if (angle < 0) {
+        angle += 360.0f;
+    }
+    if (angle == 0.0f || angle == 90.0f || angle == 180.0f || angle == 270.0f) {
+        /* Axis aligned directions use faster line replication */
+        g.start = angle < 135.0f ? grad->start : grad->stop;
+        g.stop = angle < 135.0f ? grad->stop : grad->start;
+        gui_draw_gradientrect(disp, x, y, width, height, &g, (angle == 90.0f || angle == 270.0f) ? GUI_FLAG_DRAW_GRAD_VER : GUI_FLAG_DRAW_GRAD_HOR);
+        return;
+    }
+
+    /* Project pixel position to gradient direction, weight is in 16.16 format in range 0..256 */
+    angle *= 3.14159265f / 180.0f;
+    c = cosf(angle);
+    s = sinf(angle);
+    span = GUI_MAX(fabsf(c) * (width - 1) + fabsf(s) * (height - 1), 1.0f);
+    dtx = (int32_t)(c * 256.0f * 65536.0f / span);
+    dty = (int32_t)(s * 256.0f * 65536.0f / span);
+    t0 = (c < 0 ? -dtx * (width - 1) : 0) + (s < 0 ? -dty * (height - 1) : 0);    /* Start at 0 in first corner */
+
+    layer_wait_ready();
+    for (i = y1; i < y2; i++) {
+        dst = layer_get_pointer(x1, i);
+        t = t0 + (i - y) * dty + (x1 - x) * dtx;
+        for (k = x1; k < x2; k++, t += dtx, dst += GUI.lcd.pixel_size) {
+            image_put_pixel(dst, gradient_mix(grad->start, grad->stop, GUI_MIN((uint32_t)GUI_MAX(t + 0x8000, 0) >> 16, 0x100)), DITHER_T(k, i));
+        }
+    }
+}
+
+/**
+ * \brief           Fill rectangle with radial gradient
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       grad: Gradient colors, start color is in center
+ * \param[in]       cx: Center X position, relative to rectangle
+ * \param[in]       cy: Center Y position, relative to rectangle
+ * \param[in]       r: Radius where stop color is reached. Area outside radius is filled with stop color
+ * \sa              gui_draw_gradientrect, gui_draw_lineargradient
+ */
+void
+gui_draw_radialgradient(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, gui_dim_t cx, gui_dim_t cy, gui_dim_t r) {
+    gui_dim_t x1, y1, x2, y2, i, k, m;
+    uint32_t q, d2, inv;
+    int32_t dx, dy;
+    uint8_t mirror;
+    uint8_t* dst;
+
+    if (grad == NULL || r <= 0 || !draw_clip(disp, x, y, width, height, &x1, &y1, &x2, &y2)) {
+        return;
+    }
+    cx += x;                                        /* Use absolute coordinates */
+    cy += y;
+    inv = (0x100UL << 16) / ((uint32_t)r << 4);     /* Weight for distance with 4 fraction bits */
+
+    /* Lines above and below center are equal, copy them when pixels do not depend on background */
+    mirror = !(GUI_CFG_USE_DITHER && GUI.lcd.pixel_size == 2)
+        && (grad->start >> 24) == 0xFF && (grad->stop >> 24) == 0xFF;
+
+    layer_wait_ready();
+    for (i = y1; i < y2; i++) {
+        m = 2 * cy - i;                             /* Mirrored line */
+        if (mirror && m >= y1 && m < i) {
+            layer_copy_lines(layer_get_pointer(x1, i), layer_get_pointer(x1, m), x2 - x1, 1);
+            continue;
+        }
+        if (mirror) {
+            layer_wait_ready();                     /* Copy might be in progress */
+        }
+        dst = layer_get_pointer(x1, i);
+        dy = i - cy;
+        dx = x1 - cx;
+        d2 = ((uint32_t)(dx * dx) + (uint32_t)(dy * dy)) << 8;  /* Squared distance with 4 fraction bits */
+        gui_math_isqrt(d2, &q);
+        for (k = x1; k < x2; k++, dst += GUI.lcd.pixel_size) {
+            /* Distance changes for at most 1 pixel, track integer square root incrementally */
+            while (q * q > d2) {
+                q--;
+            }
+            while ((q + 1) * (q + 1) <= d2) {
+                q++;
+            }
+            image_put_pixel(dst, gradient_mix(grad->start, grad->stop, q >= ((uint32_t)r << 4) ? 0x100 : GUI_MIN((q * inv + 0x8000) >> 16, 0x100)), DITHER_T(k, i));
+            d2 += (uint32_t)(2 * dx + 1) << 8;      /* (dx + 1)^2 = dx^2 + 2 * dx + 1 */
+            dx++;
+        }
+    }
+}
+
+/**
+ * \brief           Fill rectangle with repeated image pattern
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Rectangle width
+ * \param[in]       height: Rectangle height
+ * \param[in]       img: Pattern image, first tile starts at top left corner
+ */
+void
+gui_draw_patternrect(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_image_desc_t* img) {
+    gui_display_t d;
+    gui_dim_t tx, ty;
+
+    if (img == NULL || img->x_size <= 0 || img->y_size <= 0
+        || !draw_clip(disp, x, y, width, height, &d.x1, &d.y1, &d.x2, &d.y2)) {
+        return;
+    }
+
+    /* Draw only tiles inside clipping area */
+    for (ty = y + ((d.y1 - y) / img->y_size) * img->y_size; ty < d.y2; ty += img->y_size) {
+        for (tx = x + ((d.x1 - x) / img->x_size) * img->x_size; tx < d.x2; tx += img->x_size) {
+            gui_draw_image(&d, tx, ty, img);
+        }
+    }
+}
+
+/**
+ * \brief           Draw single color through `A8` alpha mask
+ * \note            Alpha channel of color is ignored, opacity is taken from mask only
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position
+ * \param[in]       y: Top left Y position
+ * \param[in]       width: Mask width, also used as mask line stride
+ * \param[in]       height: Mask height
+ * \param[in]       mask: Mask with one byte of alpha per pixel
+ * \param[in]       color: Color used for drawing operation
+ */
+void
+gui_draw_alphamask(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const uint8_t* mask, gui_color_t color) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_dim_t x1, y1, x2, y2, py;
+    uint8_t* dst;
+
+    if (mask == NULL || !draw_clip(disp, x, y, width, height, &x1, &y1, &x2, &y2)) {
+        return;
+    }
+    mask += (size_t)(y1 - y) * width + (x1 - x);    /* Skip invisible part of mask */
+    dst = layer_get_pointer(x1, y1);
+    if (GUI.ll.CopyChar != NULL) {
+        GUI.ll.CopyChar(&GUI.lcd, layer, dst, mask, x2 - x1, y2 - y1,
+            layer->width - (x2 - x1), width - (x2 - x1), color);
+        return;
+    }
 
+    /* Software blend, line by line */
+    layer_wait_ready();
+    for (py = y1; py < y2; py++, mask += width, dst += (size_t)layer->width * GUI.lcd.pixel_size) {
+        draw_alpha_row(dst, mask, x1, py, x2 - x1, color);
+    }
 }
 
 /**
@@ -1084,12 +2237,11 @@ gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0, gui_dim_t y
  */
 void
 gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img) {
-    uint8_t bytes = img->bpp >> 3;                  /* Get number of bytes per pixel on image */
-    
+    uint8_t bytes;
     gui_layer_t* layer;
     const uint8_t* src;
-    const uint8_t* dst;
-    gui_dim_t width, height;
+    uint8_t* dst;
+    gui_dim_t width, height, sx = 0, sy = 0;
     gui_dim_t offlineSrc, offlineDst;
     
     if (!img || !GUI_RECT_MATCH(
@@ -1100,52 +2252,210 @@ gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_de
     }
     
     layer = GUI.lcd.drawing_layer;                  /* Set layer pointer */
+    bytes = img->bpp >> 3;                          /* Get number of bytes per pixel on image */
     
     width = img->x_size;                            /* Set default width */
     height = img->y_size;                           /* Set default height */
     
-    src = (uint8_t *)(img->image);                  /* Set source address */
-    dst = (uint8_t *)(((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y - layer->y_pos) * layer->width + (x - layer->x_pos)));
-    
-    //TODO: Check proper coordinates for memory!
     if (y < disp->y1) {
-        src += (disp->y1 - y) * img->x_size * bytes;/* Set offset for number of image lines */
-        dst += (disp->y1 - y) * GUI.lcd.width * GUI.lcd.pixel_size;  /* Set offset for number of LCD lines */
-        height -= disp->y1 - y;                     /* Decrease effective height */
+        sy = disp->y1 - y;                          /* Set offset for number of image lines */
+        height -= sy;                               /* Decrease effective height */
     }
     if ((y + img->y_size) > disp->y2) {
         height -= y + img->y_size - disp->y2;       /* Decrease effective height */
     }
     if (x < disp->x1) {                             /* Set offset start address if required */
-        src += (disp->x1 - x) * bytes;              /* Set offset of start address in X direction */
-        dst += (disp->x1 - x) * GUI.lcd.pixel_size; /* Set offset of start address in X direction */
-        width -= disp->x1 - x;                      /* Decrease effective width */
+        sx = disp->x1 - x;                          /* Set offset of start address in X direction */
+        width -= sx;                                /* Decrease effective width */
     }
     if ((x + img->x_size) > disp->x2) {
         width -= x + img->x_size - disp->x2;        /* Decrease effective width */
     }
     
-    offlineSrc = img->x_size - width;               /* Set offline source */
+    /* Layer may be smaller than LCD, use its width for line offset */
+    dst = ((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y + sy - layer->y_pos) * layer->width + (x + sx - layer->x_pos));
     offlineDst = layer->width - width;              /* Set offline destination */
     
     /*******************/
     /*    Draw image   */
     /*******************/
+#if GUI_CFG_USE_IMAGE_INDEXED
+    if (img->clut != NULL && (img->bpp == 8 || img->bpp == 4)) {/* Palette-indexed image */
+        if (GUI.ll.DrawImageIndexed != NULL
+            && (img->bpp == 8 || !(sx & 0x01))) {   /* L4 lines must start on byte boundary for hardware */
+            if (img->bpp == 8) {
+                src = img->image + sy * img->x_size + sx;
+                offlineSrc = img->x_size - width;
+            } else {
+                src = img->image + sy * ((img->x_size + 1) >> 1) + (sx >> 1);
+                offlineSrc = ((img->x_size + 1) & ~0x01) - width;   /* Lines are padded to full byte */
+            }
+            GUI.ll.DrawImageIndexed(&GUI.lcd, layer, img, dst, src, width, height, offlineDst, offlineSrc);
+        } else {
+            if (GUI.ll.IsReady != NULL) {
+                while (!GUI.ll.IsReady(&GUI.lcd));  /* Software writes to memory directly */
+            }
+            draw_image_indexed(img, dst, sx, sy, width, height, offlineDst);
+        }
+        return;
+    }
+#endif /* GUI_CFG_USE_IMAGE_INDEXED */
+    
+    src = img->image + (sy * img->x_size + sx) * bytes; /* Set source address */
+    offlineSrc = img->x_size - width;               /* Set offline source */
+    
+    /*
+     * Use software when low-level driver cannot draw image
+     * or when true color image must be dithered to 16-bit layer
+     */
+    if ((bytes == 4 && GUI.ll.DrawImage32 == NULL)
+        || (bytes == 3 && GUI.ll.DrawImage24 == NULL)
+        || (bytes == 2 && GUI.ll.DrawImage16 == NULL)
+        || (GUI_CFG_USE_DITHER && GUI.lcd.pixel_size == 2 && bytes > 2)) {
+        if (bytes < 2 || bytes > 4) {
+            return;
+        }
+        if (GUI.ll.IsReady != NULL) {
+            while (!GUI.ll.IsReady(&GUI.lcd));      /* Software writes to memory directly */
+        }
+        draw_image_sw(img, dst, sx, sy, width, height, offlineDst, x + sx, y + sy);
+        return;
+    }
     if (bytes == 4) {                               /* Draw 32BPP image */
         if (GUI.ll.DrawImage32 != NULL) {           /* Draw image 32BPP if possible */
-            GUI.ll.DrawImage32(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+            GUI.ll.DrawImage32(&GUI.lcd, layer, img, dst, src, width, height, offlineDst, offlineSrc);
         }
     } else if (bytes == 3) {                        /* Draw 24BPP image */
         if (GUI.ll.DrawImage24 != NULL) {           /* Draw image 24BPP if possible */
-            GUI.ll.DrawImage24(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+            GUI.ll.DrawImage24(&GUI.lcd, layer, img, dst, src, width, height, offlineDst, offlineSrc);
         }
     } else if (bytes == 2) {                        /* Draw 16BPP image */
         if (GUI.ll.DrawImage16 != NULL) {           /* Draw image 16BPP if possible */
-            GUI.ll.DrawImage16(&GUI.lcd, GUI.lcd.drawing_layer, img, (uint8_t *)dst, (const uint8_t *)src, width, height, offlineDst, offlineSrc);
+            GUI.ll.DrawImage16(&GUI.lcd, layer, img, dst, src, width, height, offlineDst, offlineSrc);
         }
     }
 }
 
+/**
+ * \brief           Draw scaled and/or rotated image to display
+ *
+ *                  Image is rotated around its center and drawn inside bounding box,
+ *                  which top-left corner is at `x` and `y` position.
+ *                  Use \ref gui_draw_image_transformsize to get size of bounding box.
+ *
+ * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
+ * \param[in]       x: Top left X position of transformed image bounding box
+ * \param[in]       y: Top left Y position of transformed image bounding box
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       tr: Pointer to \ref gui_draw_image_transform_t with transformation parameters
+ */
+void
+gui_draw_image_ex(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img, const gui_draw_image_transform_t* tr) {
+    image_tr_map_t m;
+    gui_layer_t* layer;
+    gui_dim_t x1, y1, x2, y2;
+    uint8_t* dst;
+
+    if (img == NULL || tr == NULL) {
+        return;
+    }
+    image_transform_setup(img, tr, &m);
+    if (!GUI_RECT_MATCH(
+        disp->x1, disp->y1, disp->x2, disp->y2,
+        x, y, x + m.width, y + m.height
+    )) {
+        return;
+    }
+
+    /* Process only part of bounding box inside clipping region */
+    x1 = GUI_MAX(disp->x1 - x, 0);
+    y1 = GUI_MAX(disp->y1 - y, 0);
+    x2 = GUI_MIN(disp->x2 - x, m.width);
+    y2 = GUI_MIN(disp->y2 - y, m.height);
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+
+    layer = GUI.lcd.drawing_layer;
+    dst = ((uint8_t *)layer->start_address) + GUI.lcd.pixel_size * ((y + y1 - layer->y_pos) * layer->width + (x + x1 - layer->x_pos));
+    if (GUI.ll.IsReady != NULL) {
+        while (!GUI.ll.IsReady(&GUI.lcd));          /* Software writes to memory directly */
+    }
+    image_transform_render(img, &m, tr->flags, x1, y1, x2, y2, dst, layer->width * GUI.lcd.pixel_size, 1, x, y);
+}
+
+/**
+ * \brief           Get size of transformed image bounding box
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with image description
+ * \param[in]       tr: Pointer to \ref gui_draw_image_transform_t with transformation parameters
+ * \param[out]      width: Pointer to output variable to save bounding box width
+ * \param[out]      height: Pointer to output variable to save bounding box height
+ */
+void
+gui_draw_image_transformsize(const gui_image_desc_t* img, const gui_draw_image_transform_t* tr, gui_dim_t* width, gui_dim_t* height) {
+    image_tr_map_t m;
+
+    image_transform_setup(img, tr, &m);
+    if (width != NULL) {
+        *width = m.width;
+    }
+    if (height != NULL) {
+        *height = m.height;
+    }
+}
+
+/**
+ * \brief           Transform image into new `32` bits per pixel image
+ *
+ *                  Result can later be drawn with \ref gui_draw_image,
+ *                  which is useful for static images as transformation is done only once.
+ *
+ * \param[in]       img: Pointer to \ref gui_image_desc_t structure with source image description
+ * \param[in]       tr: Pointer to \ref gui_draw_image_transform_t with transformation parameters
+ * \param[out]      out: Pointer to \ref gui_image_desc_t structure to fill with result description
+ * \param[out]      data: Pointer to memory for result image data.
+ *                      Its size must be at least `width * height * 4` bytes,
+ *                      where size is returned by \ref gui_draw_image_transformsize
+ */
+void
+gui_draw_image_transform(const gui_image_desc_t* img, const gui_draw_image_transform_t* tr, gui_image_desc_t* out, uint8_t* data) {
+    image_tr_map_t m;
+    size_t i;
+
+    image_transform_setup(img, tr, &m);
+    for (i = 0; i < (size_t)m.width * (size_t)m.height; i++) {
+        ((uint32_t *)data)[i] = 0xFF000000UL;       /* Fully transparent, alpha is inverted */
+    }
+    image_transform_render(img, &m, tr->flags, 0, 0, m.width, m.height, data, m.width * 4, 0, 0, 0);
+
+    memset(out, 0x00, sizeof(*out));
+    out->x_size = m.width;
+    out->y_size = m.height;
+    out->bpp = 32;
+    out->image = data;
+}
+
+/**
+ * \brief           Notify drawing that color look-up table of indexed image changed
+ *
+ *                  Palette converted to display pixel format is kept between draws
+ *                  and is prepared again only for different table.
+ *                  Call this function after table entries are modified in place
+ *
+ * \note            Widgets using the image must be invalidated to be redrawn with new colors
+ * \param[in]       clut: Pointer to modified color look-up table. Set to `NULL` for any table
+ */
+void
+gui_draw_image_clutchanged(const gui_color_t* clut) {
+#if GUI_CFG_USE_IMAGE_INDEXED
+    if (clut == NULL || clut == image_pal_clut) {
+        image_pal_clut = NULL;                      /* Prepare palette on next draw */
+    }
+#else /* GUI_CFG_USE_IMAGE_INDEXED */
+    GUI_UNUSED(clut);
+#endif /* !GUI_CFG_USE_IMAGE_INDEXED */
+}
+
 /**
  * \brief           Draw polygon lines
  * \param[in,out]   disp: Pointer to \ref gui_display_t structure for display operations
@@ -1181,10 +2491,9 @@ gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t l
 void
 gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw) {
     gui_dim_t x, y;
-    uint32_t ch;
-    uint8_t i;
-    size_t cnt;
-    const gui_font_char_t* c;
+    uint32_t ch, chs[TEXT_DECODE_COUNT];
+    size_t cnt, n, k;
+    const gui_font_char_t *c, *prev;
     gui_stringrect_t rect = {0};                    /* Get string object */
     gui_string_t currStr;
     
@@ -1192,6 +2501,21 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
         draw->lineheight = font->size;              /* Set font size */
     }
     
+#if GUI_CFG_USE_TEXT_LAYOUT
+    /* Use cached line breaks and widths, when layout memory is available */
+    if (draw->layout != NULL && text_layout_get(draw->layout, font, str, draw)) {
+        draw->x += draw->layout->xoffset;           /* Align right when text is too long */
+#if GUI_CFG_USE_TEXT_RUN
+        if (text_run_get(font, str, draw, draw->layout)) {
+            text_run_draw(disp, draw, draw->layout);
+            return;
+        }
+#endif /* GUI_CFG_USE_TEXT_RUN */
+        text_layout_draw(disp, font, str, draw, draw->layout);
+        return;
+    }
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
+    
     rect.Font = font;                               /* Save font structure */
     rect.StringDraw = draw;                         /* Set drawing pointer */
     rect.IsEditMode = (draw->flags & GUI_FLAG_TEXT_EDITMODE) == GUI_FLAG_TEXT_EDITMODE; /* Check if in edit mode */
@@ -1207,53 +2531,35 @@ gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_
         }
     }
     
-    x = draw->x;                                    /* Get start X position */
-    y = draw->y;                                    /* Get start Y position */
-    
-    if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_CENTER) { /* Check for vertical align center */
-        y += (draw->height - rect.height) / 2;      /* Align center of drawing area */
-    } else if ((draw->align & GUI_VALIGN_MASK) == GUI_VALIGN_BOTTOM) {  /* Check for vertical align bottom */
-        y += draw->height - rect.height;            /* Align bottom of drawing area */
-    }
-    
-    if (y < draw->y) {
-        y = draw->y;
-    }
-    y -= draw->scrolly;                             /* Go scroll top */
-    
-    /* Check Y start value in case of edit mode = allow always on bottom */
-    if ((draw->flags & GUI_FLAG_TEXT_MULTILINE) && rect.IsEditMode) {   /* In multi-line and edit mode */
-        if (rect.height > draw->height) {           /* If text is greater than visible area in edit mode, set it to bottom align */
-            y = draw->y + draw->height - rect.height;
-        }
-    }
+    y = text_get_y(draw, rect.height);              /* Get start Y position */
     
     gui_string_prepare(&currStr, str);              /* Prepare string again */
     while ((cnt = string_rectangle(&rect, &currStr, 1)) > 0) {
-        x = draw->x;                                       
-        if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_CENTER) { /* Check for horizontal align center */
-            x += (draw->width - rect.width) / 2;    /* Align center of drawing area */
-        } else if ((draw->align & GUI_HALIGN_MASK) == GUI_HALIGN_RIGHT) {   /* Check for horizontal align right */
-            x += draw->width - rect.width;          /* Align right of drawing area */
-        }
-        while (cnt-- && gui_string_getch(&currStr, &ch, &i)) {  /* Read character by character */
-            if (rect.ReadDraw == 0) {               /* Anything to draw? */
-                continue;
-            }
-            rect.ReadDraw--;                        /* Decrease number of drawn elements */
-            
-            if (x > disp->x2) {                     /* Check if X over line */
-                continue;
-            }
-            
-            ch = get_char_from_value(ch);           /* Get char from char value */
-            if ((c = gui_text_getchardesc(font, ch)) == 0) {/* Get character pointer */
-                continue;                           /* Character is not known */
+        x = text_get_x(draw, draw->x, rect.width);  /* Get start X position of line */
+        prev = NULL;
+#if GUI_CFG_USE_TEXT_LINE
+        text_line_begin(disp, font, draw, x, y, rect.width);
+#endif /* GUI_CFG_USE_TEXT_LINE */
+        while (cnt > 0 && (n = gui_string_getchs(&currStr, chs, GUI_MIN(cnt, GUI_COUNT_OF(chs)))) > 0) {
+            cnt -= n;
+            for (k = 0; k < n && rect.ReadDraw > 0; k++) {  /* Draw decoded characters */
+                rect.ReadDraw--;                    /* Decrease number of drawn elements */
+
+                ch = get_char_from_value(chs[k]);   /* Get char from char value */
+                if ((c = gui_text_getchardesc(font, ch)) == 0) {/* Get character pointer */
+                    continue;                       /* Character is not known */
+                }
+                x += gui_text_getkerning(font, prev, c);    /* Apply kerning with previous character */
+                prev = c;
+                if (x <= disp->x2) {                /* Check if X over line */
+                    draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
+                }
+                x += c->x_size + c->x_margin;       /* Increase X position */
             }
-            draw_char(disp, font, draw, x, y, c);   /* Draw actual char */
-            
-            x += c->x_size + c->x_margin;           /* Increase X position */
         }
+#if GUI_CFG_USE_TEXT_LINE
+        text_line_end(disp, draw);
+#endif /* GUI_CFG_USE_TEXT_LINE */
         y += draw->lineheight;                      /* Go to next line */
         if (!(draw->flags & GUI_FLAG_TEXT_MULTILINE) || y > disp->y2) { /* Not multiline or over visible Y area */
             break;
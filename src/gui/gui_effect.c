@@ -0,0 +1,561 @@
+/**	
+ * \file            gui_effect.c
+ * \brief           Widget shadow and backdrop blur effects
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_effect.h"
+#include "widget/gui_widget.h"
+
+/**
+ * \brief           Blur single line in place with running sum of `2 * r + 1` samples
+ * \param[in,out]   p: Pointer to first sample of line
+ * \param[in]       tmp: Temporary memory for copy of line, `len * channels` bytes
+ * \param[in]       len: Number of samples in line
+ * \param[in]       step: Distance between samples in units of bytes
+ * \param[in]       channels: Number of interleaved channels per sample
+ * \param[in]       r: Blur radius
+ */
+static void
+blur_line(uint8_t* p, uint8_t* tmp, gui_dim_t len, size_t step, uint8_t channels, gui_dim_t r) {
+    uint32_t sum, v, mul;
+    gui_dim_t i;
+    uint8_t c;
+
+    mul = (0x10000UL + r) / (2 * r + 1);            /* Reciprocal of window size */
+    for (i = 0; i < len; i++) {                     /* Keep original samples, line is overwritten */
+        memcpy(&tmp[i * channels], &p[i * step], channels);
+    }
+    for (c = 0; c < channels; c++) {
+        /* Window is centered on first sample, edge samples are repeated */
+        sum = (uint32_t)(r + 1) * tmp[c];
+        for (i = 1; i <= r; i++) {
+            sum += tmp[GUI_MIN(i, len - 1) * channels + c];
+        }
+        for (i = 0; i < len; i++) {
+            v = (sum * mul + 0x8000) >> 16;
+            p[i * step + c] = v > 0xFF ? 0xFF : (uint8_t)v;
+            sum += tmp[GUI_MIN(i + r + 1, len - 1) * channels + c];
+            sum -= tmp[GUI_MAX(i - r, 0) * channels + c];
+        }
+    }
+}
+
+#if GUI_CFG_USE_EFFECTS || __DOXYGEN__
+
+/* Wait for low-level driver before layer memory is accessed or line buffer is released */
+static void
+effect_wait_ready(void) {
+    if (GUI.ll.IsReady != NULL) {
+        while (!GUI.ll.IsReady(&GUI.lcd));
+    }
+}
+
+/* Get effects of widget, allocate them when requested */
+static gui_effect_t *
+effect_get(gui_handle_p h, uint8_t create) {
+    if (h->effect == NULL && create) {
+        h->effect = GUI_MEMALLOC(sizeof(*h->effect));
+        GUI_MEMTAG(h->effect, GUI_MEM_TAG_EFFECT);
+    }
+    return h->effect;
+}
+
+/* Clip rectangle to inner area of all parent widgets */
+static void
+effect_clip_parents(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
+    gui_dim_t x, y;
+
+    for (; h != NULL; h = guii_widget_getparent(h)) {
+        x = guii_widget_getparentabsolutex(h);
+        y = guii_widget_getparentabsolutey(h);
+        *x1 = GUI_MAX(*x1, x);
+        *y1 = GUI_MAX(*y1, y);
+        *x2 = GUI_MIN(*x2, x + guii_widget_getparentinnerwidth(h));
+        *y2 = GUI_MIN(*y2, y + guii_widget_getparentinnerheight(h));
+    }
+}
+
+/* Get shadow rectangle on screen, not clipped by parents */
+static void
+effect_shadow_rect(gui_handle_p h, const gui_effect_t* e, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
+    *x1 = gui_widget_getabsolutex(h) + e->shadow_x - e->shadow_radius;
+    *y1 = gui_widget_getabsolutey(h) + e->shadow_y - e->shadow_radius;
+    *x2 = *x1 + gui_widget_getwidth(h) + 2 * e->shadow_radius;
+    *y2 = *y1 + gui_widget_getheight(h) + 2 * e->shadow_radius;
+}
+
+/*
+ * Build shadow profiles for widget size.
+ * Shadow of rectangle is product of horizontal and vertical blurred edge,
+ * therefore only one line for each direction is kept instead of full mask
+ */
+static uint8_t
+effect_shadow_profile(gui_effect_t* e, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t r = e->shadow_radius, b = (e->shadow_radius + 1) / 2;
+    uint8_t* py;
+
+    if (e->shadow_prof != NULL && e->shadow_width == width && e->shadow_height == height) {
+        return 1;                                   /* Profile is still valid */
+    }
+    GUI_MEMFREE(e->shadow_prof);
+    e->shadow_prof = GUI_MEMALLOC((size_t)(width + height + 4 * r));
+    if (e->shadow_prof == NULL) {
+        return 0;
+    }
+    GUI_MEMTAG(e->shadow_prof, GUI_MEM_TAG_EFFECT);
+    e->shadow_width = width;
+    e->shadow_height = height;
+
+    /* Opaque part in the middle, padding of radius on both sides */
+    py = e->shadow_prof + width + 2 * r;
+    memset(e->shadow_prof + r, 0xFF, (size_t)width);
+    memset(py + r, 0xFF, (size_t)height);
+
+    /* Two box passes give smooth edge, close to gaussian */
+    if (b > 0) {
+        gui_effect_boxblur(e->shadow_prof, width + 2 * r, 1, 1, b);
+        gui_effect_boxblur(e->shadow_prof, width + 2 * r, 1, 1, b);
+        gui_effect_boxblur(py, height + 2 * r, 1, 1, b);
+        gui_effect_boxblur(py, height + 2 * r, 1, 1, b);
+    }
+    return 1;
+}
+
+/**
+ * \brief           Draw drop shadow of widget
+ * \param[in]       h: Widget handle
+ * \param[in]       e: Widget effects
+ */
+static void
+effect_draw_shadow(gui_handle_p h, gui_effect_t* e) {
+    gui_display_t d;
+    gui_dim_t sx1, sy1, sx2, sy2, bx1, by1, bx2, by2, x, y, len;
+    uint8_t* buff, *row, *px, *py;
+    uint32_t a, ya, v;
+
+    bx1 = gui_widget_getabsolutex(h);
+    by1 = gui_widget_getabsolutey(h);
+    bx2 = bx1 + gui_widget_getwidth(h);
+    by2 = by1 + gui_widget_getheight(h);
+    if (!effect_shadow_profile(e, bx2 - bx1, by2 - by1)) {
+        return;
+    }
+
+    /* Draw inside redraw area only, shadow is clipped by parent widgets */
+    effect_shadow_rect(h, e, &sx1, &sy1, &sx2, &sy2);
+    d.x1 = GUI_MAX(GUI.display.x1, sx1);
+    d.y1 = GUI_MAX(GUI.display.y1, sy1);
+    d.x2 = GUI_MIN(GUI.display.x2, sx2);
+    d.y2 = GUI_MIN(GUI.display.y2, sy2);
+    effect_clip_parents(h, &d.x1, &d.y1, &d.x2, &d.y2);
+    if (d.x1 >= d.x2 || d.y1 >= d.y2) {
+        return;
+    }
+
+    len = d.x2 - d.x1;
+    buff = GUI_MEMFRAMEALLOC(2 * (size_t)len);      /* Two lines, low-level may still read previous one */
+    if (buff == NULL) {
+        return;
+    }
+    a = e->shadow_color >> 24;
+    px = e->shadow_prof + (d.x1 - sx1);
+    py = e->shadow_prof + (sx2 - sx1) + (d.y1 - sy1);
+    for (y = d.y1; y < d.y2; y++, py++) {
+        row = buff + ((y & 0x01) ? len : 0);
+        ya = (*py * a + 127) / 255;
+        for (x = 0; x < len; x++) {
+            v = px[x] * ya + 128;
+            row[x] = (uint8_t)((v + (v >> 8)) >> 8);    /* Divide by 255 */
+        }
+
+        /* Shadow is not drawn under widget */
+        if (y >= by1 && y < by2 && bx1 < d.x2 && bx2 > d.x1) {
+            gui_draw_alphamask(&d, d.x1, y, bx1 - d.x1, 1, row, e->shadow_color);
+            gui_draw_alphamask(&d, bx2, y, d.x2 - bx2, 1, row + (bx2 - d.x1), e->shadow_color);
+        } else {
+            gui_draw_alphamask(&d, d.x1, y, len, 1, row, e->shadow_color);
+        }
+    }
+    effect_wait_ready();
+    GUI_MEMFRAMEFREE(buff);
+}
+
+/* Read layer region and downscale it by averaging blocks of scale x scale pixels to RGB888 */
+static void
+effect_read_backdrop(uint8_t* out, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, uint8_t scale) {
+    gui_layer_t* layer = GUI.lcd.drawing_layer;
+    gui_dim_t bx, by, px, py, xe, ye;
+    uint32_t r, g, b, n, v;
+    const uint8_t* p;
+
+    effect_wait_ready();
+    for (by = 0; by < height; by += scale) {
+        ye = GUI_MIN(by + scale, height);
+        for (bx = 0; bx < width; bx += scale, out += 3) {
+            xe = GUI_MIN(bx + scale, width);
+            r = g = b = 0;
+            for (py = by; py < ye; py++) {
+                p = (const uint8_t *)layer->start_address + GUI.lcd.pixel_size *
+                    ((size_t)(y + py - layer->y_pos) * layer->width + (x + bx - layer->x_pos));
+                for (px = bx; px < xe; px++, p += GUI.lcd.pixel_size) {
+                    if (GUI.lcd.pixel_size == 2) {
+                        v = *(const uint16_t *)p;
+                        r += ((v >> 8) & 0xF8) | ((v >> 13) & 0x07);
+                        g += ((v >> 3) & 0xFC) | ((v >> 9) & 0x03);
+                        b += ((v << 3) & 0xF8) | ((v >> 2) & 0x07);
+                    } else {
+                        v = *(const uint32_t *)p;
+                        r += (v >> 16) & 0xFF;
+                        g += (v >> 8) & 0xFF;
+                        b += v & 0xFF;
+                    }
+                }
+            }
+            n = (uint32_t)(xe - bx) * (uint32_t)(ye - by);
+            out[0] = (uint8_t)((r + n / 2) / n);
+            out[1] = (uint8_t)((g + n / 2) / n);
+            out[2] = (uint8_t)((b + n / 2) / n);
+        }
+    }
+}
+
+/* Get position of output pixel in downscaled data in units of 1/256, for bilinear interpolation */
+static int32_t
+effect_src_pos(gui_dim_t pos, uint8_t scale, gui_dim_t size) {
+    int32_t f = (((int32_t)pos * 2 + 1) * 128) / scale - 128;
+    return GUI_MAX(0, GUI_MIN(f, (int32_t)(size - 1) * 256));
+}
+
+/**
+ * \brief           Draw blurred backdrop under widget
+ * \param[in]       h: Widget handle
+ * \param[in]       e: Widget effects
+ * \param[in]       fresh: Set to `1` when content under widget was redrawn in current frame
+ */
+static void
+effect_draw_backdrop(gui_handle_p h, gui_effect_t* e, uint8_t fresh) {
+    gui_display_t v, d;
+    gui_image_desc_t img = {0};
+    gui_dim_t w, hi, dw, dh, x, y, len, b;
+    int32_t fx, fy, ix, iy, ix2, iy2, wx, wy;
+    uint32_t ta, ita, tc[3], top, bot;
+    const uint8_t *r0, *r1;
+    uint8_t* buff, *row, s, c;
+
+    /* Visible part of widget on screen */
+    v.x1 = gui_widget_getabsolutex(h);
+    v.y1 = gui_widget_getabsolutey(h);
+    v.x2 = v.x1 + gui_widget_getwidth(h);
+    v.y2 = v.y1 + gui_widget_getheight(h);
+    effect_clip_parents(h, &v.x1, &v.y1, &v.x2, &v.y2);
+    w = v.x2 - v.x1;
+    hi = v.y2 - v.y1;
+    if (w <= 0 || hi <= 0) {
+        return;
+    }
+    s = e->blur_radius >= 16 ? 4 : (e->blur_radius >= 4 ? 2 : 1);
+    dw = (w + s - 1) / s;
+    dh = (hi + s - 1) / s;
+
+    /*
+     * Backdrop can be recalculated only when whole visible area under widget
+     * was redrawn in this frame, otherwise old widget content is still there
+     * and cached backdrop is used instead
+     */
+    if (fresh && GUI.display.x1 <= v.x1 && GUI.display.y1 <= v.y1
+        && GUI.display.x2 >= v.x2 && GUI.display.y2 >= v.y2) {
+        if (e->blur_data == NULL || e->blur_width != w || e->blur_height != hi || e->blur_scale != s) {
+            GUI_MEMFREE(e->blur_data);
+            e->blur_data = GUI_MEMALLOC((size_t)dw * (size_t)dh * 3);
+            if (e->blur_data == NULL) {
+                return;
+            }
+            GUI_MEMTAG(e->blur_data, GUI_MEM_TAG_EFFECT);
+            e->blur_width = w;
+            e->blur_height = hi;
+            e->blur_scale = s;
+        }
+        effect_read_backdrop(e->blur_data, v.x1, v.y1, w, hi, s);
+        b = GUI_MAX(1, (e->blur_radius + s) / (2 * s));
+        gui_effect_boxblur(e->blur_data, dw, dh, 3, b);
+        gui_effect_boxblur(e->blur_data, dw, dh, 3, b);
+    } else if (e->blur_data == NULL || e->blur_width != w || e->blur_height != hi || e->blur_scale != s) {
+        return;                                     /* Nothing valid to draw */
+    }
+
+    /* Draw only part inside widget drawing area */
+    d.x1 = GUI_MAX(GUI.display_temp.x1, v.x1);
+    d.y1 = GUI_MAX(GUI.display_temp.y1, v.y1);
+    d.x2 = GUI_MIN(GUI.display_temp.x2, v.x2);
+    d.y2 = GUI_MIN(GUI.display_temp.y2, v.y2);
+    if (d.x1 >= d.x2 || d.y1 >= d.y2) {
+        return;
+    }
+    len = d.x2 - d.x1;
+    buff = GUI_MEMFRAMEALLOC(2 * 3 * (size_t)len);  /* Two lines, low-level may still read previous one */
+    if (buff == NULL) {
+        return;
+    }
+
+    /* Premultiplied tint color */
+    ta = e->blur_tint >> 24;
+    ita = 0xFF - ta;
+    tc[0] = ((e->blur_tint >> 16) & 0xFF) * ta;
+    tc[1] = ((e->blur_tint >> 8) & 0xFF) * ta;
+    tc[2] = (e->blur_tint & 0xFF) * ta;
+
+    img.x_size = len;
+    img.y_size = 1;
+    img.bpp = 24;
+    for (y = d.y1; y < d.y2; y++) {
+        row = buff + ((y & 0x01) ? 3 * len : 0);
+        fy = effect_src_pos(y - v.y1, s, dh);
+        iy = fy >> 8;
+        wy = fy & 0xFF;
+        iy2 = GUI_MIN(iy + 1, dh - 1);
+        r0 = e->blur_data + (size_t)iy * dw * 3;
+        r1 = e->blur_data + (size_t)iy2 * dw * 3;
+        for (x = 0; x < len; x++) {
+            fx = effect_src_pos(d.x1 + x - v.x1, s, dw);
+            ix = 3 * (fx >> 8);
+            wx = fx & 0xFF;
+            ix2 = GUI_MIN(ix + 3, 3 * (dw - 1));
+            for (c = 0; c < 3; c++) {
+                top = r0[ix + c] * (256 - wx) + r0[ix2 + c] * wx;
+                bot = r1[ix + c] * (256 - wx) + r1[ix2 + c] * wx;
+                top = (top * (256 - wy) + bot * wy + 0x8000) >> 16;
+                row[3 * x + c] = (uint8_t)((top * ita + tc[c] + 127) / 255);
+            }
+        }
+        img.image = row;
+        gui_draw_image(&d, d.x1, y, &img);
+    }
+    effect_wait_ready();
+    GUI_MEMFRAMEFREE(buff);
+}
+
+/**
+ * \brief           Get area of widget including its shadow
+ * \param[in]       h: Widget handle
+ * \param[in,out]   x1: Top left X position of visible widget area on input, including shadow on output
+ * \param[in,out]   y1: Top left Y position of visible widget area on input, including shadow on output
+ * \param[in,out]   x2: Bottom right X position of visible widget area on input, including shadow on output
+ * \param[in,out]   y2: Bottom right Y position of visible widget area on input, including shadow on output
+ */
+void
+guii_effect_getarea(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2) {
+    gui_dim_t sx1, sy1, sx2, sy2;
+
+    if (h->effect == NULL || !(h->effect->shadow_color >> 24)) {
+        return;
+    }
+    effect_shadow_rect(h, h->effect, &sx1, &sy1, &sx2, &sy2);
+    effect_clip_parents(h, &sx1, &sy1, &sx2, &sy2);
+    if (sx1 < sx2 && sy1 < sy2) {
+        *x1 = GUI_MIN(*x1, sx1);
+        *y1 = GUI_MIN(*y1, sy1);
+        *x2 = GUI_MAX(*x2, sx2);
+        *y2 = GUI_MAX(*y2, sy2);
+    }
+}
+
+/**
+ * \brief           Check if widget shows blurred content under it
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+guii_effect_hasbackdrop(gui_handle_p h) {
+    return h->effect != NULL && h->effect->blur_radius > 0;
+}
+
+/**
+ * \brief           Draw widget effects before widget is drawn
+ * \note            Clipping region for widget must be set in `GUI.display_temp`
+ * \param[in]       h: Widget handle
+ * \param[in]       fresh: Set to `1` when content under widget was redrawn in current frame.
+ *                      Shadow is drawn only in this case, blurred backdrop is recalculated when possible
+ */
+void
+guii_effect_draw(gui_handle_p h, uint8_t fresh) {
+    gui_effect_t* e = h->effect;
+
+    if (e == NULL) {
+        return;
+    }
+    if (fresh && (e->shadow_color >> 24)) {
+        effect_draw_shadow(h, e);
+    }
+    if (e->blur_radius > 0) {
+        effect_draw_backdrop(h, e, fresh);
+    }
+}
+
+/**
+ * \brief           Free widget effects memory
+ * \param[in]       h: Widget handle
+ */
+void
+guii_effect_free(gui_handle_p h) {
+    if (h->effect != NULL) {
+        GUI_MEMFREE(h->effect->shadow_prof);
+        GUI_MEMFREE(h->effect->blur_data);
+        GUI_MEMFREE(h->effect);
+    }
+}
+
+/**
+ * \brief           Set drop shadow of widget
+ *
+ *                  Shadow is drawn around widget only, it is never drawn under widget itself
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       x: Shadow X offset relative to widget
+ * \param[in]       y: Shadow Y offset relative to widget
+ * \param[in]       radius: Blur radius in units of pixels. Set to `0` for sharp shadow
+ * \param[in]       color: Shadow color, alpha channel sets shadow opacity.
+ *                      Set to \ref GUI_COLOR_TRANS to disable shadow
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_effect_setshadow(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t radius, gui_color_t color) {
+    gui_effect_t* e;
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && radius >= 0);
+
+    gui_widget_invalidatewithparent(h);             /* Invalidate old shadow area */
+    e = effect_get(h, color >> 24);
+    if (e == NULL) {
+        return !(color >> 24);
+    }
+    e->shadow_x = x;
+    e->shadow_y = y;
+    e->shadow_radius = radius;
+    e->shadow_color = color;
+    GUI_MEMFREE(e->shadow_prof);                    /* Profile is not valid anymore */
+    if (!(color >> 24) && !e->blur_radius) {
+        guii_effect_free(h);                        /* No effect is used */
+    }
+    gui_widget_invalidatewithparent(h);             /* Invalidate new shadow area */
+
+    return 1;
+}
+
+/**
+ * \brief           Set backdrop blur of widget
+ *
+ *                  Content under widget is blurred and optionally tinted before widget is drawn.
+ *                  Blur is done on downscaled copy of content, which is kept in memory
+ *                  and reused until content under widget is redrawn
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       radius: Blur radius in units of pixels. Set to `0` to disable blur
+ * \param[in]       tint: Color blended over blurred content, with opacity from alpha channel.
+ *                      Set to \ref GUI_COLOR_TRANS for no tint
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_effect_setbackdropblur(gui_handle_p h, gui_dim_t radius, gui_color_t tint) {
+    gui_effect_t* e;
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h) && radius >= 0);
+
+    e = effect_get(h, radius > 0);
+    if (e == NULL) {
+        return radius == 0;
+    }
+    e->blur_radius = radius;
+    e->blur_tint = tint;
+    GUI_MEMFREE(e->blur_data);                      /* Backdrop is not valid anymore */
+    if (!radius && !(e->shadow_color >> 24)) {
+        guii_effect_free(h);                        /* No effect is used */
+    }
+    gui_widget_invalidatewithparent(h);             /* Content under widget must be drawn again */
+
+    return 1;
+}
+
+/**
+ * \brief           Remove all effects from widget
+ * \param[in]       h: Widget handle
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_effect_clear(gui_handle_p h) {
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));
+
+    if (h->effect != NULL) {
+        gui_widget_invalidatewithparent(h);         /* Invalidate shadow area first */
+        guii_effect_free(h);
+        gui_widget_invalidatewithparent(h);
+    }
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_EFFECTS || __DOXYGEN__ */
+
+/**
+ * \brief           Blur image in place with separable box filter
+ *
+ *                  Running sum is used in both directions, so processing time does not depend on radius.
+ *                  Apply filter 2 or 3 times for result close to gaussian blur
+ *
+ * \param[in,out]   data: Image data with interleaved 8-bit channels, `width * channels` bytes per line
+ * \param[in]       width: Image width in units of pixels
+ * \param[in]       height: Image height in units of pixels
+ * \param[in]       channels: Number of bytes per pixel, `1` for alpha mask or `3` for RGB888 image
+ * \param[in]       radius: Blur radius, box has `2 * radius + 1` pixels in each direction
+ */
+void
+gui_effect_boxblur(uint8_t* data, gui_dim_t width, gui_dim_t height, uint8_t channels, gui_dim_t radius) {
+    size_t stride = (size_t)width * channels;
+    uint8_t* tmp;
+    gui_dim_t i;
+
+    if (data == NULL || width <= 0 || height <= 0 || !channels || radius <= 0) {
+        return;
+    }
+    tmp = GUI_MEMFRAMEALLOC((size_t)GUI_MAX(width, height) * channels);
+    if (tmp == NULL) {
+        return;
+    }
+    if (width > 1) {                                /* Horizontal pass */
+        for (i = 0; i < height; i++) {
+            blur_line(data + i * stride, tmp, width, channels, channels, radius);
+        }
+    }
+    if (height > 1) {                               /* Vertical pass */
+        for (i = 0; i < width; i++) {
+            blur_line(data + i * channels, tmp, height, stride, channels, radius);
+        }
+    }
+    GUI_MEMFRAMEFREE(tmp);
+}
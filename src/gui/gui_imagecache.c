@@ -0,0 +1,261 @@
+/**	
+ * \file            gui_imagecache.c
+ * \brief           Decoded image cache
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#define GUI_INTERNAL
+#include "gui/gui_private.h"
+#include "gui/gui_imagecache.h"
+
+#if GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Image cache entry, decoded image data follow the structure
+ */
+typedef struct {
+    gui_linkedlist_t list;                          /*!< Linked list entry, least recently used entry is first */
+    const gui_image_desc_t* src;                    /*!< Source image, first part of key */
+    uint8_t bpp;                                    /*!< Decoded bits per pixel, second part of key */
+    uint16_t pinned;                                /*!< Pin counter, entry cannot be evicted when not `0` */
+    uint8_t removed;                                /*!< Status indicating entry was removed while pinned, it is freed on last unpin */
+    size_t size;                                    /*!< Total entry size in units of bytes */
+    gui_image_desc_t img;                           /*!< Decoded image descriptor */
+} imagecache_entry_t;
+
+static gui_linkedlistroot_t root;                   /*!< List of cached entries */
+static size_t budget = GUI_CFG_IMAGE_CACHE_SIZE;    /*!< Maximal number of bytes for cached entries */
+static gui_imagecache_stats_t stats;                /*!< Cache statistics */
+
+/**
+ * \brief           Find cache entry for image and format
+ * \param[in]       img: Source image
+ * \param[in]       bpp: Decoded bits per pixel
+ * \return          Entry on success, `NULL` otherwise
+ */
+static imagecache_entry_t *
+imagecache_find(const gui_image_desc_t* img, uint8_t bpp) {
+    imagecache_entry_t* e;
+
+    for (e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(&root, NULL); e != NULL;
+            e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(NULL, &e->list)) {
+        if (e->src == img && e->bpp == bpp && !e->removed) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief           Remove entry from cache and free its memory
+ * \param[in]       e: Entry to remove
+ */
+static void
+imagecache_free(imagecache_entry_t* e) {
+    gui_linkedlist_remove_gen(&root, &e->list);
+    stats.used -= e->size;
+    stats.entries--;
+    GUI_MEMFREE(e);
+}
+
+/**
+ * \brief           Evict least recently used unpinned entries until required size fits into budget
+ * \param[in]       size: Number of bytes to make available
+ * \return          `1` when size fits into budget, `0` otherwise
+ */
+static uint8_t
+imagecache_makeroom(size_t size) {
+    imagecache_entry_t *e, *next;
+
+    for (e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(&root, NULL);
+            e != NULL && (stats.used + size) > budget; e = next) {
+        next = (imagecache_entry_t *)gui_linkedlist_getnext_gen(NULL, &e->list);
+        if (!e->pinned) {
+            imagecache_free(e);
+            stats.evictions++;
+        }
+    }
+    return (stats.used + size) <= budget;
+}
+
+/**
+ * \brief           Get decoded image from cache, decode it on cache miss
+ *
+ *                  Decoded image has the same size as source image.
+ *                  Each line starts at new byte and pixels are packed tightly.
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       img: Source image used as cache key
+ * \param[in]       bpp: Bits per pixel of decoded image, part of cache key
+ * \param[in]       decode_fn: Decoder function called on cache miss
+ * \return          Decoded image on success, `NULL` if image could not be decoded or does not fit into budget
+ */
+const gui_image_desc_t *
+gui_imagecache_get(const gui_image_desc_t* img, uint8_t bpp, gui_imagecache_decode_fn decode_fn) {
+    imagecache_entry_t* e;
+    size_t len, hdr;
+
+    if (img == NULL || decode_fn == NULL) {
+        return NULL;
+    }
+    e = imagecache_find(img, bpp);
+    if (e != NULL) {
+        stats.hits++;
+        gui_linkedlist_remove_gen(&root, &e->list); /* Move to most recently used position */
+        gui_linkedlist_add_gen(&root, &e->list);
+        return &e->img;
+    }
+    stats.misses++;
+
+    hdr = GUI_MEM_ALIGN(sizeof(*e));
+    len = (((size_t)img->x_size * bpp + 7) >> 3) * (size_t)img->y_size;
+    if (!imagecache_makeroom(hdr + len)) {          /* Pinned entries occupy budget */
+        return NULL;
+    }
+    e = GUI_MEMALLOC(hdr + len);
+    if (e == NULL) {
+        return NULL;
+    }
+    GUI_MEMTAG(e, GUI_MEM_TAG_IMAGE);
+    e->src = img;
+    e->bpp = bpp;
+    e->size = hdr + len;
+    e->img.x_size = img->x_size;
+    e->img.y_size = img->y_size;
+    e->img.bpp = bpp;
+    e->img.image = (const uint8_t *)e + hdr;
+    if (!decode_fn(img, bpp, (uint8_t *)e + hdr, len)) {
+        GUI_MEMFREE(e);                             /* Decoding failed */
+        return NULL;
+    }
+    gui_linkedlist_add_gen(&root, &e->list);
+    stats.used += e->size;
+    stats.entries++;
+    if (stats.used > stats.used_max) {
+        stats.used_max = stats.used;
+    }
+    return &e->img;
+}
+
+/**
+ * \brief           Pin or unpin cached image
+ *
+ *                  Pinned image is never evicted from cache.
+ *                  Each pin must be followed by unpin call with the same image.
+ *                  Image removed while pinned is freed on its last unpin
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       img: Decoded image as returned by \ref gui_imagecache_get
+ * \param[in]       pin: Set to `1` to pin or `0` to unpin image
+ * \return          `1` on success, `0` if image is not in cache
+ */
+uint8_t
+gui_imagecache_pin(const gui_image_desc_t* img, uint8_t pin) {
+    imagecache_entry_t* e;
+
+    for (e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(&root, NULL); e != NULL;
+            e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(NULL, &e->list)) {
+        if (&e->img == img) {
+            break;
+        }
+    }
+    if (e == NULL) {
+        return 0;
+    }
+    if (pin) {
+        e->pinned++;
+    } else if (e->pinned) {
+        e->pinned--;
+        if (!e->pinned && e->removed) {             /* Last user of removed image */
+            imagecache_free(e);
+        }
+    }
+    return 1;
+}
+
+/**
+ * \brief           Remove all decoded versions of image from cache
+ *
+ *                  Use this function when source image data change
+ *
+ * \note            Pinned entries are not used anymore, but they are freed on last unpin
+ * \param[in]       img: Source image used as cache key. Set to `NULL` to remove all entries
+ */
+void
+gui_imagecache_remove(const gui_image_desc_t* img) {
+    imagecache_entry_t *e, *next;
+
+    for (e = (imagecache_entry_t *)gui_linkedlist_getnext_gen(&root, NULL); e != NULL; e = next) {
+        next = (imagecache_entry_t *)gui_linkedlist_getnext_gen(NULL, &e->list);
+        if (img == NULL || e->src == img) {
+            if (e->pinned) {
+                e->removed = 1;                     /* Pinned image may still be in use */
+            } else {
+                imagecache_free(e);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Set maximal number of bytes used by cached images
+ *
+ *                  When budget is decreased, least recently used entries are evicted immediately
+ *
+ * \param[in]       size: Budget in units of bytes
+ */
+void
+gui_imagecache_setbudget(size_t size) {
+    budget = size;
+    imagecache_makeroom(0);
+}
+
+/**
+ * \brief           Get image cache statistics
+ * \param[out]      s: Pointer to \ref gui_imagecache_stats_t structure to fill
+ */
+void
+gui_imagecache_getstats(gui_imagecache_stats_t* s) {
+    *s = stats;
+    s->budget = budget;
+}
+
+/**
+ * \brief           Reset hit, miss and eviction counters and maximal used memory
+ */
+void
+gui_imagecache_resetstats(void) {
+    stats.hits = 0;
+    stats.misses = 0;
+    stats.evictions = 0;
+    stats.used_max = stats.used;
+}
+
+#endif /* GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__ */
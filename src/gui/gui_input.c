@@ -51,14 +51,38 @@ static uint8_t buff_kb_data[sizeof(gui_keyboard_data_t) * GUI_CFG_KEYBOARD_BUFFE
 
 /**
  * \brief           Add new touch data to internal buffer for further processing
+ * \note            Coordinates are in panel native orientation
+ *                  and are mapped to LCD orientation, set in low-level layer
  * \param[in]       ts: Pointer to \ref gui_touch_data_t touch data with valid input
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_input_touchadd(gui_touch_data_t* const ts) {
-    uint8_t ret;
+    uint8_t ret, i;
+    gui_dim_t x;
     GUI_ASSERTPARAMS(ts);
-    
+
+    /* Map panel coordinates to logical coordinates of rotated LCD */
+    for (i = 0; i < ts->count && i < GUI_CFG_TOUCH_MAX_PRESSES; i++) {
+        x = ts->x[i];
+        switch (GUI.lcd.orientation) {
+            case GUI_LCD_ORIENTATION_90:
+                ts->x[i] = ts->y[i];
+                ts->y[i] = GUI.lcd.height - 1 - x;
+                break;
+            case GUI_LCD_ORIENTATION_180:
+                ts->x[i] = GUI.lcd.width - 1 - x;
+                ts->y[i] = GUI.lcd.height - 1 - ts->y[i];
+                break;
+            case GUI_LCD_ORIENTATION_270:
+                ts->x[i] = GUI.lcd.width - 1 - ts->y[i];
+                ts->y[i] = x;
+                break;
+            default:
+                break;
+        }
+    }
+
     ts->time = gui_sys_now();                       /* Set event time */
     ret = gui_buffer_write(&buff_ts, ts, sizeof(*ts)) ? 1 : 0;  /* Write data to buffer */
     
@@ -35,6 +35,8 @@
 #include "gui/gui_private.h"
 #include "gui/gui_lcd.h"
 
+#define GUI_LCD_ROTATE_TILE         16      /*!< Tile size in units of pixels for rotated copy */
+
 /**
  * \brief           Get LCD width in units of pixels
  * \return          LCD width in units of pixels
@@ -53,6 +55,100 @@ gui_lcd_getheight(void) {
     return GUI.lcd.height;
 }
 
+/**
+ * \brief           Get LCD orientation
+ * \return          Member of \ref gui_lcd_orientation_t enumeration
+ */
+gui_lcd_orientation_t
+gui_lcd_getorientation(void) {
+    return GUI.lcd.orientation;
+}
+
+/**
+ * \brief           Copy area of layer to panel memory in native panel orientation
+ *
+ *                  Function is used by low-level driver when active layer is set
+ *                  and LCD orientation is not \ref GUI_LCD_ORIENTATION_0.
+ *                  Area is processed in square tiles so that both source reads and destination writes
+ *                  stay within few memory lines, which keeps data cache and SDRAM row hits high
+ *
+ * \param[in]       layer: Layer with content in logical orientation
+ * \param[in]       area: Area in logical coordinates to copy, usually `layer->display`
+ * \param[out]      dst: Panel frame buffer with same pixel size as layer and panel native width
+ */
+void
+gui_lcd_rotatearea(const gui_layer_t* layer, const gui_display_t* area, void* dst) {
+    gui_dim_t x1, y1, x2, y2, tx, ty, tx2, ty2, x, y, w = GUI.lcd.width, h = GUI.lcd.height;
+    size_t ps = GUI.lcd.pixel_size, dx, dy, ds;
+    const uint8_t* s;
+    uint8_t* d;
+
+    /* Visible area only */
+    x1 = GUI_MAX(area->x1, 0);
+    y1 = GUI_MAX(area->y1, 0);
+    x2 = GUI_MIN(area->x2, w);
+    y2 = GUI_MIN(area->y2, h);
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+
+    /*
+     * Destination step in units of bytes for one pixel in X and Y direction of logical layer.
+     * Panel native width is logical height for 90 and 270 degrees
+     */
+    switch (GUI.lcd.orientation) {
+        case GUI_LCD_ORIENTATION_90:                /* Logical (x, y) is panel (h - 1 - y, x) */
+            dx = ps * h;
+            dy = (size_t)0 - ps;
+            ds = ps * (h - 1);
+            break;
+        case GUI_LCD_ORIENTATION_180:               /* Logical (x, y) is panel (w - 1 - x, h - 1 - y) */
+            dx = (size_t)0 - ps;
+            dy = (size_t)0 - ps * w;
+            ds = ps * ((size_t)w * h - 1);
+            break;
+        case GUI_LCD_ORIENTATION_270:               /* Logical (x, y) is panel (y, w - 1 - x) */
+            dx = (size_t)0 - ps * h;
+            dy = ps;
+            ds = ps * (size_t)h * (w - 1);
+            break;
+        default:                                    /* No rotation, copy lines */
+            for (y = y1; y < y2; y++) {
+                memcpy((uint8_t *)dst + ps * ((size_t)y * w + x1),
+                    (const uint8_t *)layer->start_address + ps * ((size_t)y * layer->width + x1), ps * (x2 - x1));
+            }
+            return;
+    }
+
+    for (ty = y1; ty < y2; ty = ty2) {
+        ty2 = GUI_MIN(ty + GUI_LCD_ROTATE_TILE, y2);
+        for (tx = x1; tx < x2; tx = tx2) {
+            tx2 = GUI_MIN(tx + GUI_LCD_ROTATE_TILE, x2);
+            for (y = ty; y < ty2; y++) {
+                s = (const uint8_t *)layer->start_address + ps * ((size_t)y * layer->width + tx);
+                d = (uint8_t *)dst + ds + dx * tx + dy * y;
+                switch (ps) {
+                    case 2:
+                        for (x = tx; x < tx2; x++, s += 2, d += dx) {
+                            *(uint16_t *)d = *(const uint16_t *)s;
+                        }
+                        break;
+                    case 4:
+                        for (x = tx; x < tx2; x++, s += 4, d += dx) {
+                            *(uint32_t *)d = *(const uint32_t *)s;
+                        }
+                        break;
+                    default:
+                        for (x = tx; x < tx2; x++, s += ps, d += dx) {
+                            memcpy(d, s, ps);
+                        }
+                        break;
+                }
+            }
+        }
+    }
+}
+
 /**
  * \brief           Notify GUI stack from low-level layer which layer is currently used as display layer
  * \param[in]       layer_num: Layer number used as display layer
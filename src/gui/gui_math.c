@@ -52,6 +52,35 @@ gui_math_sqrt(float x, float* const result) {
     return 0;
 }
 
+/**
+ * \brief           Calculate integer square root of input value
+ *
+ *                  \f$\ y=\lfloor sqrt{(x)} \rfloor\f$
+ *
+ * \param[in]       x: Number to calculate square root from
+ * \param[out]      result: Pointer to integer variable to store result to
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_math_isqrt(uint32_t x, uint32_t* const result) {
+    uint32_t res = 0, bit = 1UL << 30;
+
+    while (bit > x) {                               /* Find highest power of 4 not greater than input */
+        bit >>= 2;
+    }
+    while (bit) {                                   /* Calculate result bit by bit */
+        if (x >= res + bit) {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else {
+            res >>= 1;
+        }
+        bit >>= 2;
+    }
+    *result = res;
+    return 1;
+}
+
 /**
  * \brief           Calculate reverse square of input value
  *
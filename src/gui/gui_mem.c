@@ -35,11 +35,6 @@
 #include "gui/gui.h"
 #include "gui/gui_mem.h"
 
-typedef struct MemBlock {
-    struct MemBlock* NextFreeBlock;                 /*!< Pointer to next free block */
-    size_t Size;                                    /*!< Size of block */
-} MemBlock_t;
-
 /**
  * \brief           Memory alignment bits and absolute number
  */
@@ -47,15 +42,398 @@ typedef struct MemBlock {
 #define MEM_ALIGN_NUM               ((size_t)GUI_CFG_MEM_ALIGNMENT)
 #define MEM_ALIGN(x)                GUI_MEM_ALIGN(x)
 
+static size_t MemAvailableBytes = 0;
+static size_t MemMinAvailableBytes = 0;
+static size_t MemTotalSize = 0;                     /* Size of memory in units of bytes */
+
+/* Get index of most significant set bit, value must not be 0 */
+static uint8_t
+mem_fls(uint32_t x) {
+#if defined(__GNUC__)
+    return (uint8_t)(31 - __builtin_clz(x));
+#else
+    uint8_t n = 0;
+
+    if (x & 0xFFFF0000UL) {
+        x >>= 16, n += 16;
+    }
+    if (x & 0xFF00) {
+        x >>= 8, n += 8;
+    }
+    if (x & 0xF0) {
+        x >>= 4, n += 4;
+    }
+    if (x & 0x0C) {
+        x >>= 2, n += 2;
+    }
+    return n + ((x & 0x02) ? 1 : 0);
+#endif /* !defined(__GNUC__) */
+}
+
+/* Get index of least significant set bit, value must not be 0 */
+#define mem_ffs(x)                  mem_fls((x) & (0 - (x)))
+
+#if GUI_CFG_USE_MEM_TAG
+
+/**
+ * \brief           Live allocations of single tag
+ */
+typedef struct {
+    const char* name;                               /*!< Tag name, `NULL` when tag is not used */
+    size_t bytes;                                   /*!< Live bytes, including block metadata */
+    size_t count;                                   /*!< Number of live blocks */
+    size_t max_bytes;                               /*!< Maximal number of live bytes ever */
+} mem_tag_t;
+
+/* Built-in tags, in order of gui_mem_tag_t */
+static mem_tag_t mem_tags[GUI_CFG_MEM_TAG_COUNT] = {
+    { "other", 0, 0, 0 },
+    { "widget", 0, 0, 0 },
+    { "text", 0, 0, 0 },
+    { "glyph", 0, 0, 0 },
+    { "image", 0, 0, 0 },
+    { "layer", 0, 0, 0 },
+    { "effect", 0, 0, 0 },
+    { "list", 0, 0, 0 },
+    { "timer", 0, 0, 0 },
+    { "pool", 0, 0, 0 },
+    { "frame", 0, 0, 0 },
+};
+
+/* Add block to tag statistics */
+static void
+mem_tag_add(uint8_t tag, size_t size) {
+    mem_tag_t* t = &mem_tags[tag];
+
+    t->bytes += size;
+    t->count++;
+    if (t->bytes > t->max_bytes) {
+        t->max_bytes = t->bytes;
+    }
+}
+
+/* Remove block from tag statistics */
+static void
+mem_tag_sub(uint8_t tag, size_t size) {
+    mem_tags[tag].bytes -= size;
+    mem_tags[tag].count--;
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG */
+
+/* Add free block of user size to statistics */
+static void
+mem_stat_add(gui_mem_stat_t* stat, size_t size) {
+    uint8_t i;
+
+    i = size < 32 ? 0 : (uint8_t)(mem_fls((uint32_t)GUI_MIN(size, 0xFFFFFFFFUL)) - 4);
+    stat->hist[GUI_MIN(i, GUI_MEM_STAT_HIST_SIZE - 1)]++;
+    stat->free_blocks++;
+    stat->free_sum += size;
+    if (size > stat->largest_free) {
+        stat->largest_free = size;
+    }
+}
+
+#if GUI_CFG_USE_MEM_TLSF
+
+/*
+ * Two-level segregated fit allocator
+ *
+ * Free blocks are kept in lists by size class. First level is power of 2 of block size,
+ * second level splits each power of 2 range to TLSF_SL_COUNT linear classes.
+ * Bitmaps of non-empty lists give suitable free block without any search.
+ * Free blocks are merged with physical neighbours, each region ends with used sentinel block
+ */
+
+/**
+ * \brief           Memory block, free list pointers are valid only in free blocks
+ */
+typedef struct mem_block {
+    struct mem_block* prev_phys;                    /*!< Previous physical block, valid only when it is free */
+    size_t size;                                    /*!< Block size including header, lower bits are flags */
+#if GUI_CFG_USE_MEM_TAG
+    uint8_t tag;                                    /*!< Allocation tag, valid only when block is used */
+#endif /* GUI_CFG_USE_MEM_TAG */
+    struct mem_block* next_free;                    /*!< Next block in free list */
+    struct mem_block* prev_free;                    /*!< Previous block in free list */
+} mem_block_t;
+
+#define TLSF_ALIGN                  (MEM_ALIGN_NUM > sizeof(void *) ? MEM_ALIGN_NUM : sizeof(void *))
+#define TLSF_ALIGN_UP(x)            (((x) + TLSF_ALIGN - 1) & ~(TLSF_ALIGN - 1))
+#define TLSF_HDR_SIZE               TLSF_ALIGN_UP(offsetof(mem_block_t, next_free))
+#define TLSF_MIN_SIZE               TLSF_ALIGN_UP(sizeof(mem_block_t))
+#define TLSF_SL_LOG2                4
+#define TLSF_SL_COUNT               (1 << TLSF_SL_LOG2)
+#define TLSF_FL_COUNT               20
+#define TLSF_SMALL_SIZE             (TLSF_ALIGN * TLSF_SL_COUNT)    /* Smaller blocks are all in first level 0 */
+#define TLSF_MAX_SIZE               ((size_t)TLSF_SMALL_SIZE << (TLSF_FL_COUNT - 1))
+
+#define TLSF_FREE                   ((size_t)0x01)  /* Block is free */
+#define TLSF_PREV_FREE              ((size_t)0x02)  /* Previous physical block is free */
+#define TLSF_SIZE(b)                ((b)->size & ~(TLSF_FREE | TLSF_PREV_FREE))
+#define TLSF_NEXT_PHYS(b)           ((mem_block_t *)((uint8_t *)(b) + TLSF_SIZE(b)))
+
+static uint32_t tlsf_fl_bitmap;                     /* Non-empty first level classes */
+static uint16_t tlsf_sl_bitmap[TLSF_FL_COUNT];      /* Non-empty second level classes */
+static mem_block_t* tlsf_heads[TLSF_FL_COUNT][TLSF_SL_COUNT];
+static uint8_t tlsf_assigned;
+
+/* Get first and second level class of block size */
+static void
+tlsf_mapping(size_t size, uint8_t* fl, uint8_t* sl) {
+    uint8_t f;
+
+    if (size < TLSF_SMALL_SIZE) {
+        *fl = 0;
+        *sl = (uint8_t)(size / TLSF_ALIGN);
+    } else {
+        f = mem_fls((uint32_t)size);
+        *fl = (uint8_t)(f - mem_fls(TLSF_SMALL_SIZE) + 1);
+        *sl = (uint8_t)((size >> (f - TLSF_SL_LOG2)) - TLSF_SL_COUNT);
+    }
+}
+
+/* Insert free block to list of its size class */
+static void
+tlsf_insert(mem_block_t* b) {
+    uint8_t fl, sl;
+
+    tlsf_mapping(TLSF_SIZE(b), &fl, &sl);
+    b->prev_free = NULL;
+    b->next_free = tlsf_heads[fl][sl];
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b;
+    }
+    tlsf_heads[fl][sl] = b;
+    tlsf_fl_bitmap |= (uint32_t)1 << fl;
+    tlsf_sl_bitmap[fl] |= (uint16_t)(1 << sl);
+}
+
+/* Remove free block from list of its size class */
+static void
+tlsf_remove(mem_block_t* b) {
+    uint8_t fl, sl;
+
+    tlsf_mapping(TLSF_SIZE(b), &fl, &sl);
+    if (b->next_free != NULL) {
+        b->next_free->prev_free = b->prev_free;
+    }
+    if (b->prev_free != NULL) {
+        b->prev_free->next_free = b->next_free;
+    } else if ((tlsf_heads[fl][sl] = b->next_free) == NULL) {
+        tlsf_sl_bitmap[fl] &= (uint16_t)~(1 << sl);
+        if (!tlsf_sl_bitmap[fl]) {
+            tlsf_fl_bitmap &= ~((uint32_t)1 << fl);
+        }
+    }
+}
+
+uint8_t
+mem_assignmem(const mem_region_t* regions, size_t len) {
+    uint8_t* addr;
+    size_t size;
+    mem_block_t *b, *end;
+
+    if (tlsf_assigned) {                            /* Regions already defined */
+        return 0;
+    }
+    for (; len > 0; len--, regions++) {
+        addr = (uint8_t *)regions->start_address;
+        size = regions->size;
+        if ((size_t)addr & (TLSF_ALIGN - 1)) {      /* Check alignment boundary */
+            if (size < TLSF_ALIGN) {
+                continue;
+            }
+            size -= TLSF_ALIGN - ((size_t)addr & (TLSF_ALIGN - 1));
+            addr += TLSF_ALIGN - ((size_t)addr & (TLSF_ALIGN - 1));
+        }
+        size &= ~(TLSF_ALIGN - 1);
+        if (size < TLSF_MIN_SIZE + TLSF_HDR_SIZE) {
+            continue;
+        }
+        size -= TLSF_HDR_SIZE;                      /* Leave space for sentinel block */
+        if (size >= TLSF_MAX_SIZE) {
+            size = TLSF_MAX_SIZE - TLSF_ALIGN;
+        }
+
+        /* One free block for entire region, followed by used sentinel with size 0 */
+        b = (mem_block_t *)addr;
+        b->prev_phys = NULL;
+        b->size = size | TLSF_FREE;
+        end = TLSF_NEXT_PHYS(b);
+        end->prev_phys = b;
+        end->size = TLSF_PREV_FREE;
+        tlsf_insert(b);
+
+        MemAvailableBytes += size;
+        MemTotalSize += size;
+    }
+    MemMinAvailableBytes = MemAvailableBytes;       /* Save minimum ever available bytes in region */
+    tlsf_assigned = 1;
+    return 1;
+}
+
+static void*
+mem_alloc(size_t size) {
+    mem_block_t *b, *r;
+    size_t search;
+    uint32_t map;
+    uint8_t fl, sl;
+
+    if (!tlsf_assigned || !size || size >= TLSF_MAX_SIZE) {
+        return NULL;
+    }
+    size = TLSF_ALIGN_UP(size) + TLSF_HDR_SIZE;
+    if (size < TLSF_MIN_SIZE) {
+        size = TLSF_MIN_SIZE;
+    }
+
+    /* Round up to next class, any block in its list is big enough */
+    search = size;
+    if (search >= TLSF_SMALL_SIZE) {
+        search += ((size_t)1 << (mem_fls((uint32_t)search) - TLSF_SL_LOG2)) - 1;
+    }
+    tlsf_mapping(search, &fl, &sl);
+    if (fl >= TLSF_FL_COUNT) {
+        return NULL;
+    }
+
+    /* Find non-empty class in the same first level or any bigger */
+    map = tlsf_sl_bitmap[fl] & ((uint32_t)0xFFFF << sl);
+    if (!map) {
+        map = tlsf_fl_bitmap & ~(((uint32_t)2 << fl) - 1);
+        if (!map) {
+            return NULL;                            /* No free block of required size */
+        }
+        fl = mem_ffs(map);
+        map = tlsf_sl_bitmap[fl];
+    }
+    sl = mem_ffs(map);
+    b = tlsf_heads[fl][sl];
+    tlsf_remove(b);
+
+    /* Return remaining part of block to free lists */
+    if (TLSF_SIZE(b) - size >= TLSF_MIN_SIZE) {
+        r = (mem_block_t *)((uint8_t *)b + size);
+        r->size = (TLSF_SIZE(b) - size) | TLSF_FREE;
+        TLSF_NEXT_PHYS(r)->prev_phys = r;
+        b->size = size | (b->size & (TLSF_FREE | TLSF_PREV_FREE));
+        tlsf_insert(r);
+    } else {
+        TLSF_NEXT_PHYS(b)->size &= ~TLSF_PREV_FREE;
+    }
+    b->size &= ~TLSF_FREE;
+#if GUI_CFG_USE_MEM_TAG
+    b->tag = GUI_MEM_TAG_OTHER;
+    mem_tag_add(b->tag, TLSF_SIZE(b));
+#endif /* GUI_CFG_USE_MEM_TAG */
+
+    MemAvailableBytes -= TLSF_SIZE(b);              /* Decrease available memory */
+    if (MemAvailableBytes < MemMinAvailableBytes) { /* Check if current available memory is less than ever before */
+        MemMinAvailableBytes = MemAvailableBytes;   /* Update minimal available memory */
+    }
+    return (uint8_t *)b + TLSF_HDR_SIZE;
+}
+
+static void
+mem_free(void* ptr) {
+    mem_block_t *b, *n;
+
+    if (ptr == NULL) {                              /* To be in compliance with C free function */
+        return;
+    }
+    b = (mem_block_t *)((uint8_t *)ptr - TLSF_HDR_SIZE);
+    if (b->size & TLSF_FREE) {                      /* Block is not allocated */
+        return;
+    }
+    MemAvailableBytes += TLSF_SIZE(b);              /* Increase available bytes back */
+#if GUI_CFG_USE_MEM_TAG
+    mem_tag_sub(b->tag, TLSF_SIZE(b));
+#endif /* GUI_CFG_USE_MEM_TAG */
+
+    /* Merge with free physical neighbours */
+    if (b->size & TLSF_PREV_FREE) {
+        n = b;
+        b = b->prev_phys;
+        tlsf_remove(b);
+        b->size += TLSF_SIZE(n);
+    }
+    n = TLSF_NEXT_PHYS(b);
+    if (n->size & TLSF_FREE) {
+        tlsf_remove(n);
+        b->size += TLSF_SIZE(n);
+        n = TLSF_NEXT_PHYS(b);
+    }
+    b->size |= TLSF_FREE;
+    n->prev_phys = b;
+    n->size |= TLSF_PREV_FREE;
+    tlsf_insert(b);
+}
+
+/* Get size of user memory from input pointer */
+static size_t
+mem_getusersize(void* ptr) {
+    mem_block_t* b;
+
+    if (ptr == NULL) {
+        return 0;
+    }
+    b = (mem_block_t *)((uint8_t *)ptr - TLSF_HDR_SIZE);
+    if (b->size & TLSF_FREE) {
+        return 0;
+    }
+    return TLSF_SIZE(b) - TLSF_HDR_SIZE;
+}
+
+#if GUI_CFG_USE_MEM_TAG
+
+/* Get pointer to tag of used block and block size */
+static uint8_t*
+mem_gettag(void* ptr, size_t* size) {
+    mem_block_t* b;
+
+    b = (mem_block_t *)((uint8_t *)ptr - TLSF_HDR_SIZE);
+    if (b->size & TLSF_FREE) {
+        return NULL;
+    }
+    *size = TLSF_SIZE(b);
+    return &b->tag;
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG */
+
+/* Add all free blocks to statistics */
+static void
+mem_getfreeblocks(gui_mem_stat_t* stat) {
+    const mem_block_t* b;
+    size_t fl, sl;
+
+    for (fl = 0; fl < TLSF_FL_COUNT; fl++) {
+        for (sl = 0; sl < TLSF_SL_COUNT; sl++) {
+            for (b = tlsf_heads[fl][sl]; b != NULL; b = b->next_free) {
+                mem_stat_add(stat, TLSF_SIZE(b) - TLSF_HDR_SIZE);
+            }
+        }
+    }
+}
+
+#else /* GUI_CFG_USE_MEM_TLSF */
+
+typedef struct MemBlock {
+    struct MemBlock* NextFreeBlock;                 /*!< Pointer to next free block */
+    size_t Size;                                    /*!< Size of block */
+#if GUI_CFG_USE_MEM_TAG
+    uint8_t Tag;                                    /*!< Allocation tag, valid only when block is allocated */
+#endif /* GUI_CFG_USE_MEM_TAG */
+} MemBlock_t;
+
 #define MEMBLOCK_METASIZE           MEM_ALIGN(sizeof(MemBlock_t))
 
 static MemBlock_t StartBlock;
 static MemBlock_t* EndBlock = 0;
-static size_t MemAvailableBytes = 0;
-static size_t MemMinAvailableBytes = 0;
 static size_t MemAllocBit = 0;
 
-static size_t MemTotalSize = 0;                     /* Size of memory in units of bytes */
 /* Insert block to list of free blocks */
 static void
 mem_insertfreeblock(MemBlock_t* newBlock) {
@@ -186,6 +564,7 @@ mem_assignmem(const mem_region_t* regions, size_t len) {
         
         /* Set number of free bytes available to allocate in region */
         MemAvailableBytes += FirstBlock->Size;
+        MemTotalSize += FirstBlock->Size;
         
         regions++;                                  /* Go to next region */
     }
@@ -258,10 +637,14 @@ mem_alloc(size_t size) {
              */
             mem_insertfreeblock(Next);              /* Insert free memory block to list of free memory blocks (linked list chain) */
         }
+        MemAvailableBytes -= Curr->Size;            /* Decrease available memory, block may be bigger than requested */
+#if GUI_CFG_USE_MEM_TAG
+        Curr->Tag = GUI_MEM_TAG_OTHER;
+        mem_tag_add(Curr->Tag, Curr->Size);
+#endif /* GUI_CFG_USE_MEM_TAG */
         Curr->Size |= MemAllocBit;                  /* Set allocated bit = memory is allocated */
         Curr->NextFreeBlock = 0;                    /* Clear next free block pointer as there is no one */
 
-        MemAvailableBytes -= size;                  /* Decrease available memory */
         if (MemAvailableBytes < MemMinAvailableBytes) { /* Check if current available memory is less than ever before */
             MemMinAvailableBytes = MemAvailableBytes;   /* Update minimal available memory */
         }
@@ -293,6 +676,9 @@ mem_free(void* ptr) {
          */
         block->Size &= ~MemAllocBit;                /* Clear allocated bit */
         MemAvailableBytes += block->Size;           /* Increase available bytes back */
+#if GUI_CFG_USE_MEM_TAG
+        mem_tag_sub(block->Tag, block->Size);
+#endif /* GUI_CFG_USE_MEM_TAG */
         mem_insertfreeblock(block);                 /* Insert block to list of free blocks */
     }
 }
@@ -312,6 +698,55 @@ mem_getusersize(void* ptr) {
     return 0;
 }
 
+#if GUI_CFG_USE_MEM_TAG
+
+/* Get pointer to tag of allocated block and block size */
+static uint8_t*
+mem_gettag(void* ptr, size_t* size) {
+    MemBlock_t* block;
+
+    block = (MemBlock_t *)(((uint8_t *)ptr) - MEMBLOCK_METASIZE);
+    if (!(block->Size & MemAllocBit) || block->NextFreeBlock != NULL) {
+        return NULL;
+    }
+    *size = block->Size & ~MemAllocBit;
+    return &block->Tag;
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG */
+
+/* Add all free blocks to statistics, end blocks of regions have size 0 */
+static void
+mem_getfreeblocks(gui_mem_stat_t* stat) {
+    const MemBlock_t* block;
+
+    for (block = StartBlock.NextFreeBlock; block != NULL; block = block->NextFreeBlock) {
+        if (block->Size > MEMBLOCK_METASIZE) {
+            mem_stat_add(stat, block->Size - MEMBLOCK_METASIZE);
+        }
+    }
+}
+
+#endif /* !GUI_CFG_USE_MEM_TLSF */
+
+#if GUI_CFG_USE_MEM_TAG
+
+/* Move used block to statistics of new tag */
+static void
+mem_settag(void* ptr, uint8_t tag) {
+    uint8_t* t;
+    size_t size;
+
+    if (ptr == NULL || tag >= GUI_CFG_MEM_TAG_COUNT || (t = mem_gettag(ptr, &size)) == NULL) {
+        return;
+    }
+    mem_tag_sub(*t, size);
+    *t = tag;
+    mem_tag_add(tag, size);
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG */
+
 /* Allocate memory and set it to 0 */
 static void*
 mem_calloc(size_t num, size_t size) {
@@ -329,6 +764,9 @@ static void*
 mem_realloc(void* ptr, size_t size) {
     void* newPtr;
     size_t oldSize;
+#if GUI_CFG_USE_MEM_TAG
+    uint8_t* tag;
+#endif /* GUI_CFG_USE_MEM_TAG */
     
     if (!ptr) {                                     /* If pointer is not valid */
         return mem_alloc(size);                     /* Only allocate memory */
@@ -338,6 +776,11 @@ mem_realloc(void* ptr, size_t size) {
     newPtr = mem_alloc(size);                       /* Try to allocate new memory block */
     if (newPtr != NULL) {                           /* Check success */
         memcpy(newPtr, ptr, size > oldSize ? oldSize : size);   /* Copy old data to new array */
+#if GUI_CFG_USE_MEM_TAG
+        if ((tag = mem_gettag(ptr, &oldSize)) != NULL) {
+            mem_settag(newPtr, *tag);               /* Keep tag of old block */
+        }
+#endif /* GUI_CFG_USE_MEM_TAG */
         mem_free(ptr);                              /* Free old pointer */
         return newPtr;                              /* Return new pointer */
     }
@@ -471,3 +914,484 @@ gui_mem_assignmemory(const gui_mem_region_t* regions, size_t len) {
 
     return ret;                                     
 }
+
+/**
+ * \brief           Get heap statistics with list of free blocks
+ *
+ *                  Fragmentation index tells how much of free memory cannot be used for single allocation,
+ *                  `0` when all free memory is in one block and close to `1000` when it is split to many small blocks
+ *
+ * \note            Function walks all free blocks and is not intended to be called on every allocation
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[out]      stat: Pointer to \ref gui_mem_stat_t structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_mem_getstat(gui_mem_stat_t* stat) {
+    if (stat == NULL) {
+        return 0;
+    }
+    memset(stat, 0x00, sizeof(*stat));
+    stat->total = MemTotalSize;
+    stat->free = MemAvailableBytes;
+    stat->min_free = MemMinAvailableBytes;
+    mem_getfreeblocks(stat);
+    if (stat->free_sum > 0) {
+        stat->fragmentation = (uint16_t)(1000 - (uint16_t)((uint64_t)stat->largest_free * 1000 / stat->free_sum));
+    }
+    return 1;
+}
+
+#if GUI_CFG_USE_MEM_TAG || __DOXYGEN__
+
+/**
+ * \brief           Set allocation tag of memory block
+ *
+ *                  Block is counted in statistics of \ref GUI_MEM_TAG_OTHER until tag is set.
+ *                  Tag is kept on reallocation
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       ptr: Pointer to memory returned by \ref gui_mem_alloc, \ref gui_mem_calloc or \ref gui_mem_realloc
+ * \param[in]       tag: Tag, member of \ref gui_mem_tag_t or value returned by \ref gui_mem_tag_register
+ */
+void
+gui_mem_settag(void* ptr, uint8_t tag) {
+#if GUI_CFG_USE_MEM
+    mem_settag(ptr, tag);
+#else /* GUI_CFG_USE_MEM */
+    GUI_UNUSED(ptr);
+    GUI_UNUSED(tag);
+#endif /* !GUI_CFG_USE_MEM */
+}
+
+/**
+ * \brief           Get tag for name, tag is created on first call
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       name: Tag name, pointer must stay valid for entire lifetime of GUI
+ * \return          Tag on success, \ref GUI_MEM_TAG_OTHER when all tags are in use
+ */
+uint8_t
+gui_mem_tag_register(const char* name) {
+    size_t i;
+
+    if (name == NULL) {
+        return GUI_MEM_TAG_OTHER;
+    }
+    for (i = 0; i < GUI_ARRAYSIZE(mem_tags); i++) {
+        if (mem_tags[i].name == NULL) {
+            mem_tags[i].name = name;
+            return (uint8_t)i;
+        } else if (mem_tags[i].name == name || !strcmp(mem_tags[i].name, name)) {
+            return (uint8_t)i;
+        }
+    }
+    return GUI_MEM_TAG_OTHER;
+}
+
+/**
+ * \brief           Get live allocations of tag
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       tag: Tag to get info for, starting with `0`
+ * \param[out]      info: Pointer to \ref gui_mem_tag_info_t structure to fill
+ * \return          `1` on success, `0` when tag does not exist
+ */
+uint8_t
+gui_mem_tag_getinfo(uint8_t tag, gui_mem_tag_info_t* info) {
+    const mem_tag_t* t;
+
+    if (info == NULL || tag >= GUI_ARRAYSIZE(mem_tags) || mem_tags[tag].name == NULL) {
+        return 0;
+    }
+    t = &mem_tags[tag];
+    info->name = t->name;
+    info->bytes = t->bytes;
+    info->count = t->count;
+    info->max_bytes = t->max_bytes;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG || __DOXYGEN__ */
+
+#if GUI_CFG_USE_MEM_POOL || __DOXYGEN__
+
+/*
+ * Fixed size block pools
+ *
+ * Each pool serves one block size and consists of slabs, allocated from main heap.
+ * Slab holds GUI_CFG_MEM_POOL_BLOCKS blocks with bitmap of used blocks.
+ * Slabs with at least one free block are in partial list, others in full list,
+ * first slab in partial list gives free block without any search.
+ * Empty slabs move to empty list for next allocations, at least GUI_CFG_MEM_POOL_KEEP_SLABS of them
+ * and more while they are needed to hold used blocks again, surplus is returned to main heap.
+ * Every block starts with pointer to its slab, blocks allocated from main heap
+ * when pool cannot be used have it set to `NULL`
+ */
+
+struct mem_pool;
+
+/**
+ * \brief           Slab header, followed by blocks
+ */
+typedef struct mem_slab {
+    struct mem_slab* next;                          /*!< Next slab in list */
+    struct mem_slab* prev;                          /*!< Previous slab in list */
+    struct mem_pool* pool;                          /*!< Pool slab belongs to */
+    uint32_t used;                                  /*!< Bitmap of used blocks */
+} mem_slab_t;
+
+/**
+ * \brief           Pool of blocks of single size
+ */
+typedef struct mem_pool {
+    size_t size;                                    /*!< Aligned user size of block, `0` when pool is not used */
+    mem_slab_t* partial;                            /*!< Slabs with used and free blocks */
+    mem_slab_t* full;                               /*!< Slabs without free blocks */
+    size_t slabs;                                   /*!< Number of allocated slabs */
+    mem_slab_t* unused;                             /*!< Empty slabs kept for next allocations */
+    size_t empty;                                   /*!< Number of empty slabs in unused list */
+    size_t used;                                    /*!< Number of used blocks */
+    size_t max_used;                                /*!< Maximal number of used blocks ever */
+} mem_pool_t;
+
+#if GUI_CFG_MEM_POOL_BLOCKS < 1 || GUI_CFG_MEM_POOL_BLOCKS > 32
+#error "GUI_CFG_MEM_POOL_BLOCKS must be between 1 and 32"
+#endif
+
+#define POOL_SLAB_HDR_SIZE          MEM_ALIGN(sizeof(mem_slab_t))
+#define POOL_BLOCK_HDR_SIZE         MEM_ALIGN(sizeof(mem_slab_t *))
+#define POOL_STRIDE(p)              (POOL_BLOCK_HDR_SIZE + (p)->size)
+#define POOL_SLAB_SIZE(p)           (POOL_SLAB_HDR_SIZE + POOL_STRIDE(p) * GUI_CFG_MEM_POOL_BLOCKS)
+#define POOL_BLOCK(s, i)            ((uint8_t *)(s) + POOL_SLAB_HDR_SIZE + (size_t)(i) * POOL_STRIDE((s)->pool))
+#define POOL_FULL                   ((uint32_t)(0xFFFFFFFFUL >> (32 - GUI_CFG_MEM_POOL_BLOCKS)))
+
+static mem_pool_t mem_pools[GUI_CFG_MEM_POOL_COUNT];
+
+/* Get pool for block size, create new one if it does not exist yet */
+static mem_pool_t *
+pool_get(size_t size) {
+    size_t i;
+
+    for (i = 0; i < GUI_ARRAYSIZE(mem_pools); i++) {
+        if (mem_pools[i].size == size) {
+            return &mem_pools[i];
+        } else if (mem_pools[i].size == 0) {        /* Pools are used in order, first empty one is free */
+            mem_pools[i].size = size;
+            return &mem_pools[i];
+        }
+    }
+    return NULL;
+}
+
+/* Add slab to beginning of list */
+static void
+pool_slab_push(mem_slab_t** list, mem_slab_t* s) {
+    s->prev = NULL;
+    s->next = *list;
+    if (s->next != NULL) {
+        s->next->prev = s;
+    }
+    *list = s;
+}
+
+/* Remove slab from list */
+static void
+pool_slab_unlink(mem_slab_t** list, mem_slab_t* s) {
+    if (s->next != NULL) {
+        s->next->prev = s->prev;
+    }
+    if (s->prev != NULL) {
+        s->prev->next = s->next;
+    } else {
+        *list = s->next;
+    }
+}
+
+/* Return surplus empty slabs to main heap, when pool keeps more than needed */
+static void
+pool_trim(mem_pool_t* p) {
+    mem_slab_t* s;
+    size_t keep;
+
+    keep = (p->used + GUI_CFG_MEM_POOL_BLOCKS - 1) / GUI_CFG_MEM_POOL_BLOCKS;
+#if GUI_CFG_MEM_POOL_KEEP_SLABS
+    if (keep < GUI_CFG_MEM_POOL_KEEP_SLABS) {
+        keep = GUI_CFG_MEM_POOL_KEEP_SLABS;
+    }
+#endif /* GUI_CFG_MEM_POOL_KEEP_SLABS */
+    while (p->empty > keep && (s = p->unused) != NULL) {
+        pool_slab_unlink(&p->unused, s);
+        gui_mem_free(s);
+        p->slabs--;
+        p->empty--;
+    }
+}
+
+/**
+ * \brief           Allocate block from pool of blocks with the same size
+ *
+ *                  Pool for block size is created on first allocation.
+ *                  When no pool is available for new size or slab cannot be allocated,
+ *                  block is allocated from main heap instead
+ *
+ * \note            Memory is not reset to zero, use \ref gui_mem_pool_calloc when needed
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       size: Block size in units of bytes
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_pool_alloc(size_t size) {
+    mem_pool_t* p;
+    mem_slab_t* s;
+    uint8_t* ptr;
+    uint8_t i;
+
+    if (!size) {
+        return NULL;
+    }
+    if ((p = pool_get(MEM_ALIGN(size))) != NULL) {
+        if ((s = p->partial) == NULL) {             /* All slabs are full */
+            if ((s = p->unused) != NULL) {          /* Use kept empty slab again */
+                pool_slab_unlink(&p->unused, s);
+                p->empty--;
+            } else if ((s = gui_mem_alloc(POOL_SLAB_SIZE(p))) != NULL) {    /* Add new slab */
+                GUI_MEMTAG(s, GUI_MEM_TAG_POOL);
+                s->pool = p;
+                s->used = 0;
+                p->slabs++;
+            }
+            if (s != NULL) {
+                pool_slab_push(&p->partial, s);
+            }
+        }
+        if (s != NULL) {
+            i = mem_ffs(~s->used);                  /* First free block in slab */
+            s->used |= (uint32_t)1 << i;
+            if (s->used == POOL_FULL) {             /* Move slab to full list */
+                pool_slab_unlink(&p->partial, s);
+                pool_slab_push(&p->full, s);
+            }
+            if (++p->used > p->max_used) {
+                p->max_used = p->used;
+            }
+            ptr = POOL_BLOCK(s, i);
+            *(mem_slab_t **)ptr = s;
+            return ptr + POOL_BLOCK_HDR_SIZE;
+        }
+    }
+
+    /* Use main heap, block has no slab */
+    if ((ptr = gui_mem_alloc(POOL_BLOCK_HDR_SIZE + size)) == NULL) {
+        return NULL;
+    }
+    GUI_MEMTAG(ptr, GUI_MEM_TAG_POOL);
+    *(mem_slab_t **)ptr = NULL;
+    return ptr + POOL_BLOCK_HDR_SIZE;
+}
+
+/**
+ * \brief           Allocate block from pool and reset its memory to zero
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       size: Block size in units of bytes
+ * \return          Allocated memory on success, `NULL` otherwise
+ * \sa              gui_mem_pool_alloc
+ */
+void*
+gui_mem_pool_calloc(size_t size) {
+    void* ptr;
+
+    if ((ptr = gui_mem_pool_alloc(size)) != NULL) {
+        memset(ptr, 0x00, size);
+    }
+    return ptr;
+}
+
+/**
+ * \brief           Free block, previously allocated with \ref gui_mem_pool_alloc
+ *
+ *                  When slab gets empty, pool keeps at least \ref GUI_CFG_MEM_POOL_KEEP_SLABS
+ *                  empty slabs and more while they are needed to hold used blocks again.
+ *                  Surplus empty slabs are returned to main heap
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       ptr: Pointer to block to free
+ */
+void
+gui_mem_pool_free(void* ptr) {
+    mem_pool_t* p;
+    mem_slab_t* s;
+    uint32_t bit;
+
+    if (ptr == NULL) {
+        return;
+    }
+    ptr = (uint8_t *)ptr - POOL_BLOCK_HDR_SIZE;
+    if ((s = *(mem_slab_t **)ptr) == NULL) {        /* Block is from main heap */
+        gui_mem_free(ptr);
+        return;
+    }
+    p = s->pool;
+    bit = (uint32_t)1 << (((uint8_t *)ptr - POOL_BLOCK(s, 0)) / POOL_STRIDE(p));
+    if (!(s->used & bit)) {                         /* Block is not allocated */
+        return;
+    }
+    if (s->used == POOL_FULL) {                     /* Slab has free block now */
+        pool_slab_unlink(&p->full, s);
+        pool_slab_push(&p->partial, s);
+    }
+    s->used &= ~bit;
+    p->used--;
+    if (!s->used) {                                 /* Keep empty slab for next allocations */
+        pool_slab_unlink(&p->partial, s);
+        pool_slab_push(&p->unused, s);
+        p->empty++;
+        pool_trim(p);                               /* Return surplus empty slabs to heap */
+    }
+}
+
+/**
+ * \brief           Get usage of memory pool
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       index: Pool index, starting with `0`
+ * \param[out]      info: Pointer to \ref gui_mem_pool_info_t structure to fill
+ * \return          `1` on success, `0` when pool with index does not exist
+ */
+uint8_t
+gui_mem_pool_getinfo(size_t index, gui_mem_pool_info_t* info) {
+    const mem_pool_t* p;
+
+    if (info == NULL || index >= GUI_ARRAYSIZE(mem_pools) || !mem_pools[index].size) {
+        return 0;
+    }
+    p = &mem_pools[index];
+    info->block_size = p->size;
+    info->slabs = p->slabs;
+    info->capacity = p->slabs * GUI_CFG_MEM_POOL_BLOCKS;
+    info->used = p->used;
+    info->max_used = p->max_used;
+    info->mem_size = p->slabs * POOL_SLAB_SIZE(p);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM_POOL || __DOXYGEN__ */
+
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+
+/*
+ * Frame arena
+ *
+ * Bump allocator for memory used only during single redraw.
+ * Every allocation starts with offset of allocation before, so freeing last allocation
+ * moves top back and memory can be reused within the same redraw.
+ * Other allocations are released all together with reset at the end of redraw
+ */
+
+#define FRAME_ALIGN                 (MEM_ALIGN_NUM > sizeof(size_t) ? MEM_ALIGN_NUM : sizeof(size_t))
+#define FRAME_ALIGN_UP(x)           (((x) + FRAME_ALIGN - 1) & ~(FRAME_ALIGN - 1))
+#define FRAME_HDR_SIZE              FRAME_ALIGN_UP(sizeof(size_t))
+#define FRAME_NONE                  ((size_t)-1)
+#define FRAME_BASE                  ((uint8_t *)FRAME_ALIGN_UP((size_t)frame_arena))
+
+static uint8_t frame_arena[GUI_CFG_MEM_FRAME_SIZE + FRAME_ALIGN];
+static size_t frame_top;                            /* Offset of first free byte */
+static size_t frame_last = FRAME_NONE;              /* Offset of last allocation header */
+static size_t frame_max_used;                       /* Maximal number of bytes used or requested */
+static size_t frame_overflows;                      /* Number of allocations made from main heap */
+
+/**
+ * \brief           Allocate zeroed memory, valid only until the end of current redraw
+ *
+ *                  When frame arena is full, memory is allocated from main heap
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       size: Number of bytes to allocate
+ * \return          Allocated memory on success, `NULL` otherwise
+ */
+void*
+gui_mem_frame_alloc(size_t size) {
+    uint8_t* ptr;
+    size_t top;
+
+    if (!size) {
+        return NULL;
+    }
+    top = frame_top + FRAME_HDR_SIZE + FRAME_ALIGN_UP(size);
+    if (size > GUI_CFG_MEM_FRAME_SIZE || top > GUI_CFG_MEM_FRAME_SIZE) {
+        frame_overflows++;
+        if (top > frame_max_used) {
+            frame_max_used = top;                   /* Arena size, that would be enough */
+        }
+        if ((ptr = gui_mem_calloc(1, size)) != NULL) {
+            GUI_MEMTAG(ptr, GUI_MEM_TAG_FRAME);
+        }
+        return ptr;
+    }
+
+    ptr = FRAME_BASE + frame_top;
+    *(size_t *)ptr = frame_last;                    /* Save previous allocation */
+    frame_last = frame_top;
+    frame_top = top;
+    if (frame_top > frame_max_used) {
+        frame_max_used = frame_top;
+    }
+    ptr += FRAME_HDR_SIZE;
+    memset(ptr, 0x00, size);
+    return ptr;
+}
+
+/**
+ * \brief           Free memory previously allocated with \ref gui_mem_frame_alloc
+ *
+ *                  Memory of last allocation is available again immediately,
+ *                  other allocations are released at the end of redraw
+ *
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       ptr: Pointer to memory to free
+ */
+void
+gui_mem_frame_free(void* ptr) {
+    size_t off;
+
+    if (ptr == NULL) {
+        return;
+    }
+    if ((uint8_t *)ptr < FRAME_BASE || (uint8_t *)ptr >= FRAME_BASE + GUI_CFG_MEM_FRAME_SIZE) {
+        gui_mem_free(ptr);                          /* Memory is from main heap */
+        return;
+    }
+    off = (size_t)((uint8_t *)ptr - FRAME_BASE) - FRAME_HDR_SIZE;
+    if (off == frame_last) {                        /* Last allocation, move top back */
+        frame_top = off;
+        frame_last = *(size_t *)(FRAME_BASE + off);
+    }
+}
+
+/**
+ * \brief           Release all frame arena memory
+ * \note            Called at the end of redraw, memory from arena must not be used after that
+ * \note            This function is private and may be called only when OS protection is active
+ */
+void
+gui_mem_frame_reset(void) {
+    frame_top = 0;
+    frame_last = FRAME_NONE;
+}
+
+/**
+ * \brief           Get usage of frame arena
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[out]      info: Pointer to \ref gui_mem_frame_info_t structure to fill
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_mem_frame_getinfo(gui_mem_frame_info_t* info) {
+    if (info == NULL) {
+        return 0;
+    }
+    info->size = GUI_CFG_MEM_FRAME_SIZE;
+    info->used = frame_top;
+    info->max_used = frame_max_used;
+    info->overflows = frame_overflows;
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
@@ -34,6 +34,9 @@
 #define GUI_INTERNAL
 #include "gui/gui_string.h"
 
+/* Check if any byte in 32-bit word is zero or has bit 7 set (not ASCII character) */
+#define STRING_NOT_ASCII(w)     ((((w) - 0x01010101UL) | (w)) & 0x80808080UL)
+
 /**
  * \brief           Initialize unicode processing structure
  * \param[in]       s: Pointer to \ref gui_string_unicode_t to initialize to default values
@@ -209,6 +212,7 @@ gui_string_prepare(gui_string_t* const s, const gui_char* const str) {
     s->str = str;                           /* Save string pointer */
 #if GUI_CFG_USE_UNICODE
     gui_string_unicode_init(&s->s);         /* Prepare unicode structure */
+    s->end = NULL;                          /* End is found when needed */
 #endif /* GUI_CFG_USE_UNICODE */
     return 1;
 }
@@ -234,6 +238,14 @@ gui_string_getch(gui_string_t* const s, uint32_t* const out, uint8_t* const len)
     if (s == NULL || s->str == NULL || !*s->str) {  /* End of string check */
         return 0;
     }
+    if (!s->s.r && *s->str < 0x80) {        /* ASCII character does not need decoder */
+        *out = s->s.res = *s->str++;        /* Keep decoder state as if character was decoded */
+        s->s.t = 1;
+        if (len != NULL) {
+            *len = 1;
+        }
+        return 1;
+    }
     
     while (*s->str) {                       /* Check all characters */
         r = gui_string_unicode_decode(&s->s, *s->str++);    /* Try to decode string */
@@ -259,6 +271,67 @@ gui_string_getch(gui_string_t* const s, uint32_t* const out, uint8_t* const len)
 #endif /* GUI_CFG_USE_UNICODE */  
 }
 
+/**
+ * \brief           Get multiple decoded characters from source string
+ *
+ *                  Runs of ASCII characters are detected `8` bytes at a time and copied without decoding.
+ *                  Words are only read at aligned addresses and only when at least `8` bytes
+ *                  are left before string termination, found on first call
+ *
+ * \param[in,out]   s: Pointer to \ref gui_string_t structure with input string,
+ *                      pointer is moved after last decoded character
+ * \param[out]      out: Pointer to output array for decoded characters
+ * \param[in]       count: Maximal number of characters to decode
+ * \return          Number of decoded characters, `0` at the end of string
+ * \sa              gui_string_getch
+ */
+size_t
+gui_string_getchs(gui_string_t* const s, uint32_t* out, size_t count) {
+    size_t n = 0;
+#if GUI_CFG_USE_UNICODE
+    uint32_t w[2];
+    size_t k;
+#endif /* GUI_CFG_USE_UNICODE */
+
+    if (s == NULL || s->str == NULL) {
+        return 0;
+    }
+#if GUI_CFG_USE_UNICODE
+    if (s->end == NULL) {
+        s->end = s->str + strlen((const char *)s->str);
+    }
+#endif /* GUI_CFG_USE_UNICODE */
+    while (n < count) {
+#if GUI_CFG_USE_UNICODE
+        if (!s->s.r && count - n >= 8 && s->end - s->str >= 8 && !((uintptr_t)s->str & 0x03)) {
+            memcpy(&w[0], s->str, sizeof(w[0]));
+            if (!STRING_NOT_ASCII(w[0])) {
+                memcpy(&w[1], s->str + 4, sizeof(w[1]));
+                if (!STRING_NOT_ASCII(w[1])) {
+                    for (k = 0; k < 8; k++) {
+                        out[n++] = s->str[k];
+                    }
+                    s->s.res = s->str[7];
+                    s->s.t = 1;
+                    s->str += 8;
+                    continue;
+                }
+            }
+        }
+        if (!gui_string_getch(s, &out[n], NULL)) {
+            break;
+        }
+        n++;
+#else
+        if (!*s->str) {                     /* End of string check */
+            break;
+        }
+        out[n++] = *s->str++;
+#endif /* GUI_CFG_USE_UNICODE */
+    }
+    return n;
+}
+
 /**
  * \brief           Get character by character from end of string up
  * \note            Functionality is the same as \ref gui_string_getch except order is swapped
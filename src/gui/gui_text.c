@@ -39,6 +39,95 @@
 #define CH_WS                       GUI_KEY_WS
 #define get_char_from_value(ch)     (uint32_t)((CH_CR == (ch) || CH_LF == (ch)) ? CH_WS : (ch))
 
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE
+
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE & (GUI_CFG_FONT_RANGE_CACHE_SIZE - 1)
+#error "GUI_CFG_FONT_RANGE_CACHE_SIZE must be power of 2"
+#endif
+
+/**
+ * \brief           Direct-mapped cache entry of character lookup in font ranges
+ */
+typedef struct {
+    const gui_font_t* font;                         /*!< Font, `NULL` when entry is not used */
+    uint32_t ch;                                    /*!< Character code */
+    const gui_font_char_t* c;                       /*!< Character descriptor, `NULL` when font does not have character */
+} range_cache_entry_t;
+
+static range_cache_entry_t range_cache[GUI_CFG_FONT_RANGE_CACHE_SIZE];
+
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE */
+
+#if GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+
+/**
+ * \brief           Advance width table built in RAM for font without one
+ */
+typedef struct {
+    const gui_font_t* font;                         /*!< Font, `NULL` when entry is not used */
+    uint32_t used;                                  /*!< Time of last use, entry with the lowest time is replaced first */
+    uint8_t valid;                                  /*!< Set to `1` when table is built, `0` when font widths do not fit to table */
+    uint8_t advance[GUI_FONT_ADVANCE_COUNT];        /*!< Advance widths */
+} advance_cache_entry_t;
+
+static advance_cache_entry_t advance_cache[GUI_CFG_FONT_ADVANCE_CACHE_SIZE];
+static uint32_t advance_cache_time;                 /*!< Time of last use of any entry */
+
+#endif /* GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+
+/**
+ * \brief           Find character descriptor in font
+ * \param[in]       font: Font to search in
+ * \param[in]       ch: Unicode decoded character
+ * \return          Character descriptor on success, `NULL` if font does not have character
+ */
+static const gui_font_char_t *
+font_find_char(const gui_font_t* font, uint32_t ch) {
+    const gui_font_range_t* r;
+    const gui_font_char_t* c = NULL;
+    size_t lo, hi, mid;
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE
+    range_cache_entry_t* e;
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE */
+
+    if (ch < font->startchar || ch > font->endchar) {
+        return NULL;
+    }
+    if (font->ranges == NULL) {                     /* Single range of characters */
+        return &font->data[ch - font->startchar];
+    }
+
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE
+    e = &range_cache[(ch ^ ((uint32_t)(uintptr_t)font >> 4)) & (GUI_CFG_FONT_RANGE_CACHE_SIZE - 1)];
+    if (e->font == font && e->ch == ch) {
+        return e->c;
+    }
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE */
+
+    /* Binary search in sorted ranges */
+    lo = 0;
+    hi = font->ranges_count;
+    while (lo < hi) {
+        mid = (lo + hi) >> 1;
+        r = &font->ranges[mid];
+        if (ch < r->first) {
+            hi = mid;
+        } else if (ch > r->last) {
+            lo = mid + 1;
+        } else {
+            c = &font->data[r->index + (ch - r->first)];
+            break;
+        }
+    }
+
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE
+    e->font = font;
+    e->ch = ch;
+    e->c = c;
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE */
+    return c;
+}
+
 /**
  * \brief           Get character descriptor from specific character and font
  * \param[in]       font: Font to use for drawing
@@ -47,16 +136,160 @@
  */
 const gui_font_char_t *
 gui_text_getchardesc(const gui_font_t* font, uint32_t ch) {
-    ch = get_char_from_value(ch);
-    /* Try to get character from font */
-    if (ch >= font->startchar && ch <= font->endchar) {
-        return &font->data[(ch)-font->startchar];
+    const gui_font_char_t* c;
+
+    c = font_find_char(font, get_char_from_value(ch));  /* Try to get character from font */
+    if (c == NULL) {
+        c = font_find_char(font, '?');              /* If it doesn't exist, try with question mark */
+    }
+    return c;
+}
+
+#if GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+
+/**
+ * \brief           Get time for least recently used replacement of advance tables
+ * \return          New time, starting with `1`
+ */
+static uint32_t
+advance_cache_gettime(void) {
+    size_t i;
 
-    /* If it doesn't exist, try with question mark */
-    } else if ('?' >= font->startchar && '?' <= font->endchar) {
-        return &font->data[(uint32_t)'?' - font->startchar];
+    if (++advance_cache_time == 0) {                /* Restart on overflow, all entries are equal */
+        for (i = 0; i < GUI_CFG_FONT_ADVANCE_CACHE_SIZE; i++) {
+            advance_cache[i].used = 0;
+        }
+        advance_cache_time = 1;
+    }
+    return advance_cache_time;
+}
+
+#endif /* GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+
+/**
+ * \brief           Get advance width table of font
+ * \param[in]       font: Font to get table for
+ * \return          Table with \ref GUI_FONT_ADVANCE_COUNT entries, `NULL` when not available
+ */
+static const uint8_t *
+font_get_advance(const gui_font_t* font) {
+#if GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+    advance_cache_entry_t* e;
+    const gui_font_char_t* c;
+    size_t i;
+#endif /* GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+
+    if (font->advance != NULL) {
+        return font->advance;
+    }
+
+#if GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+    e = &advance_cache[0];
+    for (i = 0; i < GUI_CFG_FONT_ADVANCE_CACHE_SIZE; i++) {
+        if (advance_cache[i].font == font) {
+            advance_cache[i].used = advance_cache_gettime();
+            return advance_cache[i].valid ? advance_cache[i].advance : NULL;
+        }
+        if (advance_cache[i].used < e->used) {      /* Least recently used or unused entry */
+            e = &advance_cache[i];
+        }
+    }
+
+    /* Build new table, unknown characters have width of replacement character */
+    e->font = font;
+    e->used = advance_cache_gettime();
+    e->valid = 1;
+    for (i = 0; i < GUI_FONT_ADVANCE_COUNT; i++) {
+        c = gui_text_getchardesc(font, GUI_FONT_ADVANCE_FIRST + i);
+        if (c != NULL && (c->x_size + c->x_margin) > 0xFF) {
+            e->valid = 0;                           /* Width does not fit to table, remember font has no table */
+            return NULL;
+        }
+        e->advance[i] = c != NULL ? (uint8_t)(c->x_size + c->x_margin) : 0;
     }
+    return e->advance;
+#else /* GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
     return NULL;
+#endif /* !GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+}
+
+/**
+ * \brief           Get advance width of character, distance to next character on line without kerning
+ *
+ *                  Widths of characters `0x20 - 0x7F` are taken from font advance table
+ *
+ * \param[in]       font: Font used for character
+ * \param[in]       ch: Unicode decoded character
+ * \return          Advance width in units of pixels, `0` if character is not available
+ */
+gui_dim_t
+gui_text_getadvance(const gui_font_t* font, uint32_t ch) {
+    const gui_font_char_t* c;
+    const uint8_t* adv;
+
+    ch = get_char_from_value(ch);
+    if ((ch - GUI_FONT_ADVANCE_FIRST) < GUI_FONT_ADVANCE_COUNT && (adv = font_get_advance(font)) != NULL) {
+        return adv[ch - GUI_FONT_ADVANCE_FIRST];
+    }
+    c = gui_text_getchardesc(font, ch);
+    return c != NULL ? (c->x_size + c->x_margin) : 0;
+}
+
+/**
+ * \brief           Get cumulative widths of string characters in single pass
+ *
+ *                  Entry `i` is width of first `i + 1` characters, kerning included.
+ *                  Widths can be used with \ref gui_text_getfitcount to find position in string with binary search
+ *
+ * \param[in]       font: Font used for string
+ * \param[in]       str: String to measure
+ * \param[out]      widths: Array to save widths to
+ * \param[in]       count: Maximal number of entries in widths array
+ * \return          Number of entries written, equal to number of characters when array is large enough
+ */
+size_t
+gui_text_getwidths(const gui_font_t* font, const gui_char* str, gui_dim_t* widths, size_t count) {
+    const gui_font_char_t *c, *prev = NULL;
+    gui_string_t s;
+    gui_dim_t w = 0;
+    uint32_t ch;
+    uint8_t i;
+    size_t n;
+
+    gui_string_prepare(&s, str);
+    for (n = 0; n < count && gui_string_getch(&s, &ch, &i); n++) {
+        if (font->kerning == NULL) {                /* Kerning needs descriptors, widths are enough otherwise */
+            w += gui_text_getadvance(font, ch);
+        } else if ((c = gui_text_getchardesc(font, ch)) != NULL) {
+            w += c->x_size + c->x_margin + gui_text_getkerning(font, prev, c);
+            prev = c;
+        }
+        widths[n] = w;
+    }
+    return n;
+}
+
+/**
+ * \brief           Get number of first characters which fit to width
+ * \note            Widths must not decrease, which is true unless kerning is larger than character advance width
+ * \param[in]       widths: Cumulative widths from \ref gui_text_getwidths
+ * \param[in]       count: Number of entries in widths array
+ * \param[in]       width: Available width in units of pixels
+ * \return          Number of characters with total width not larger than available width
+ */
+size_t
+gui_text_getfitcount(const gui_dim_t* widths, size_t count, gui_dim_t width) {
+    size_t lo = 0, hi = count, mid;
+
+    while (lo < hi) {                               /* Find first entry wider than available width */
+        mid = (lo + hi) >> 1;
+        if (widths[mid] <= width) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
 }
 
 /**
@@ -80,6 +313,144 @@ gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_
     }
 }
 
+/**
+ * \brief           Get kerning between two characters
+ * \param[in]       font: Font used for characters
+ * \param[in]       left: Left character, previous on line. Set to `NULL` on line start
+ * \param[in]       right: Right character
+ * \return          Adjustment of horizontal position of right character in units of pixels
+ */
+gui_dim_t
+gui_text_getkerning(const gui_font_t* font, const gui_font_char_t* left, const gui_font_char_t* right) {
+    size_t first, second, lo, hi, mid;
+
+    if (font->kerning == NULL || left == NULL || right == NULL) {
+        return 0;
+    }
+    first = (size_t)(left - font->data);
+    second = (size_t)(right - font->data);
+
+    /* Binary search through pairs of left character */
+    lo = font->kerning_index[first];
+    hi = font->kerning_index[first + 1];
+    while (lo < hi) {
+        mid = (lo + hi) / 2;
+        if (font->kerning[mid].second == second) {
+            return font->kerning[mid].value;
+        } else if (font->kerning[mid].second < second) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+#if GUI_CFG_FONT_CACHE_SLOTS < 1 || (GUI_CFG_FONT_CACHE_SLOTS & (GUI_CFG_FONT_CACHE_SLOTS - 1))
+#error "GUI_CFG_FONT_CACHE_SLOTS must be power of 2"
+#endif
+
+#define CACHE_MASK                  (GUI_CFG_FONT_CACHE_SLOTS - 1)
+#define CACHE_MAX_ENTRIES           (GUI_CFG_FONT_CACHE_SLOTS - GUI_CFG_FONT_CACHE_SLOTS / 4)
+
+static gui_font_charentry_t* cache_table[GUI_CFG_FONT_CACHE_SLOTS];    /*!< Open addressing hash table of cached glyphs */
+static gui_linkedlistroot_t cache_lru;              /*!< List of cached glyphs, least recently used entry is first */
+static size_t cache_budget = GUI_CFG_FONT_CACHE_SIZE;   /*!< Maximal number of bytes for cached glyphs */
+static gui_text_cachestats_t cache_stats;           /*!< Cache statistics */
+
+#if GUI_CFG_USE_FONT_ATLAS
+static gui_font_atlas_t atlases[GUI_CFG_FONT_ATLAS_COUNT];  /*!< Fonts packed to single alpha texture */
+
+/**
+ * \brief           Get atlas of font
+ * \param[in]       font: Font to get atlas for
+ * \return          Atlas on success, `NULL` if font is not packed
+ */
+static gui_font_atlas_t *
+atlas_get(const gui_font_t* font) {
+    size_t i;
+
+    for (i = 0; i < GUI_CFG_FONT_ATLAS_COUNT; i++) {
+        if (atlases[i].font == font && font != NULL) {
+            return &atlases[i];
+        }
+    }
+    return NULL;
+}
+#endif /* GUI_CFG_USE_FONT_ATLAS */
+
+/* Wait for low-level driver, it may still copy character from memory which is about to be freed */
+static void
+cache_wait_ready(void) {
+    if (GUI.ll.IsReady != NULL) {
+        while (!GUI.ll.IsReady(&GUI.lcd));
+    }
+}
+
+/**
+ * \brief           Get hash table home slot for font and character
+ * \param[in]       font: Font used for character
+ * \param[in]       c: Character info handle
+ * \return          Slot index
+ */
+static size_t
+cache_slot(const gui_font_t* font, const gui_font_char_t* c) {
+    uint32_t h;
+
+    h = (uint32_t)(uintptr_t)c ^ ((uint32_t)(uintptr_t)font * 0x9E3779B1UL);
+    h ^= h >> 15;
+    h *= 0x2C1B3C6DUL;
+    h ^= h >> 12;
+    return (size_t)h & CACHE_MASK;
+}
+
+/**
+ * \brief           Remove entry from hash table and LRU list and free its memory
+ *
+ *                  Entries after removed one are shifted back,
+ *                  so that lookups never stop on empty slot before reaching their entry
+ *
+ * \param[in]       entry: Entry to remove
+ */
+static void
+cache_free(gui_font_charentry_t* entry) {
+    size_t i, j, k;
+
+    for (i = cache_slot(entry->font, entry->ch); cache_table[i] != entry; i = (i + 1) & CACHE_MASK) {}
+    cache_table[i] = NULL;
+    for (j = (i + 1) & CACHE_MASK; cache_table[j] != NULL; j = (j + 1) & CACHE_MASK) {
+        k = cache_slot(cache_table[j]->font, cache_table[j]->ch);
+        /* Move entry to empty slot if its home slot is not cyclically between empty slot and entry */
+        if ((j > i && (k <= i || k > j)) || (j < i && k <= i && k > j)) {
+            cache_table[i] = cache_table[j];
+            cache_table[j] = NULL;
+            i = j;
+        }
+    }
+    gui_linkedlist_remove_gen(&cache_lru, &entry->list);
+    cache_stats.used -= entry->size;
+    cache_stats.entries--;
+    cache_wait_ready();                             /* Entry may be source of character copy in progress */
+    GUI_MEMFREE(entry);
+}
+
+/**
+ * \brief           Evict least recently used entries until new entry fits into budget and hash table
+ * \param[in]       size: Number of bytes of new entry. Set to `0` to only apply budget
+ * \return          `1` when entry fits, `0` otherwise
+ */
+static uint8_t
+cache_makeroom(size_t size) {
+    gui_font_charentry_t* entry;
+
+    while ((cache_stats.used + size > cache_budget || (size > 0 && cache_stats.entries >= CACHE_MAX_ENTRIES))
+            && (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&cache_lru, NULL)) != NULL) {
+        cache_free(entry);
+        cache_stats.evictions++;
+    }
+    return cache_stats.used + size <= cache_budget;
+}
+
 /**
  * \brief           Get character entry generated in memory for fast drawing
  * \param[in]       font: Font used for character
@@ -89,19 +460,193 @@ gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_
 gui_font_charentry_t *
 gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry;
+    size_t i;
 
-    /* Process all characters on linked list */
-    for (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&GUI.root_fonts, NULL); entry != NULL;
-        entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(NULL, (gui_linkedlist_t *)entry)) {
+    for (i = cache_slot(font, c); (entry = cache_table[i]) != NULL; i = (i + 1) & CACHE_MASK) {
         if (entry->font == font && entry->ch == c) {
+            cache_stats.hits++;
+            gui_linkedlist_remove_gen(&cache_lru, &entry->list);  /* Move to most recently used position */
+            gui_linkedlist_add_gen(&cache_lru, &entry->list);
             return entry;
         }
     }
-    return 0;
+    cache_stats.misses++;
+    return NULL;
+}
+
+/**
+ * \brief           Get number of bits per pixel of font character data
+ * \param[in]       font: Font to get bits per pixel for
+ * \return          `1`, `2`, `4` or `8` bits per pixel
+ */
+uint8_t
+gui_text_getfontbpp(const gui_font_t* font) {
+    if (font->flags & GUI_FLAG_FONT_AA8) {
+        return 8;
+    } else if (font->flags & GUI_FLAG_FONT_AA4) {
+        return 4;
+    } else if (font->flags & GUI_FLAG_FONT_AA) {
+        return 2;
+    }
+    return 1;
 }
 
 /**
- * \brief           Create new entry for character map and put it to linked list of known entries
+ * \brief           Initialize decoder for run-length encoded character
+ * \param[out]      rle: Decoder state
+ * \param[in]       font: Font with \ref GUI_FLAG_FONT_RLE flag
+ * \param[in]       c: Character descriptor
+ */
+void
+gui_text_rle_init(gui_font_rle_t* rle, const gui_font_t* font, const gui_font_char_t* c) {
+    memset(rle, 0x00, sizeof(*rle));
+    rle->data = c->data;
+    rle->bpp = gui_text_getfontbpp(font);
+}
+
+/**
+ * \brief           Get next span of pixels with the same coverage from run-length encoded character
+ *
+ *                  Pixels of character are encoded line by line, packets may continue to next line.
+ *                  Each packet starts with header byte:
+ *
+ *                  - `0VVnnnnn`: Run of `n + 1` pixels with coverage value `V`,
+ *                      value has font bits per pixel and count takes remaining `7 - bpp` bits.
+ *                      For `8` bits per pixel, header is `0nnnnnnn` and value follows in next byte
+ *                  - `1nnnnnnn`: Literal of `n + 1` pixels, followed by coverage values
+ *                      packed in font bits per pixel, most significant bits first
+ *
+ * \note            Caller must not read more pixels than character has
+ * \param[in,out]   rle: Decoder state
+ * \param[out]      alpha: Coverage of span pixels, scaled to `0x00 - 0xFF` range
+ * \param[out]      len: Number of pixels in span
+ * \param[in]       max: Maximal number of pixels to return, rest of run is returned on next call
+ */
+void
+gui_text_rle_getspan(gui_font_rle_t* rle, uint8_t* alpha, uint8_t* len, uint8_t max) {
+    uint8_t b, mask = (uint8_t)((1 << rle->bpp) - 1), level;
+
+    if (rle->count == 0) {                          /* Start of new packet */
+        b = *rle->data++;
+        if (b & 0x80) {
+            rle->literal = 1;
+            rle->count = (b & 0x7F) + 1;
+            rle->bit = 8;
+        } else if (rle->bpp == 8) {
+            rle->literal = 0;
+            rle->count = b + 1;
+            rle->value = *rle->data++;
+        } else {
+            rle->literal = 0;
+            rle->count = (b & ((1 << (7 - rle->bpp)) - 1)) + 1;
+            rle->value = b >> (7 - rle->bpp);
+        }
+    }
+    if (rle->literal) {                             /* Literals are returned one by one */
+        rle->bit -= rle->bpp;
+        level = (*rle->data >> rle->bit) & mask;
+        if (rle->bit == 0 || rle->count == 1) {     /* Next byte or next packet */
+            rle->data++;
+            rle->bit = 8;
+        }
+        rle->count--;
+        *len = 1;
+    } else {
+        level = rle->value;
+        *len = GUI_MIN(rle->count, max);
+        rle->count -= *len;
+    }
+    *alpha = (uint8_t)((level * 0xFF) / mask);
+}
+
+/**
+ * \brief           Decode one line of character to alpha values with one byte per pixel
+ * \param[in]       font: Font for character
+ * \param[in]       c: Character descriptor
+ * \param[in,out]   rle: Decoder state for run-length encoded fonts, initialized with \ref gui_text_rle_init.
+ *                      Lines must be decoded in order from first one. Not used for other fonts
+ * \param[in]       y: Line number to decode
+ * \param[out]      row: Memory for `x_size` alpha values
+ */
+void
+gui_text_getcharrow(const gui_font_t* font, const gui_font_char_t* c, gui_font_rle_t* rle, uint8_t y, uint8_t* row) {
+    uint8_t bpp, mask, scale, x, len, a;
+    const uint8_t* src;
+    size_t bit;
+
+    if (font->flags & GUI_FLAG_FONT_RLE) {          /* Decode spans directly to row */
+        for (x = 0; x < c->x_size; x += len) {
+            gui_text_rle_getspan(rle, &a, &len, (uint8_t)(c->x_size - x));
+            memset(&row[x], a, len);
+        }
+        return;
+    }
+
+    bpp = gui_text_getfontbpp(font);
+    mask = (uint8_t)((1 << bpp) - 1);
+    scale = (uint8_t)(0xFF / mask);                 /* Scale coverage levels to full alpha range */
+    src = c->data + (size_t)y * (((size_t)c->x_size * bpp + 7) >> 3);   /* Lines start at new byte */
+    for (x = 0, bit = 0; x < c->x_size; x++, bit += bpp) {
+        row[x] = (uint8_t)(((src[bit >> 3] >> (8 - bpp - (bit & 0x07))) & mask) * scale);
+    }
+}
+
+/* Combine alpha of overlapping characters, `d + a - d * a` in normalized range */
+#define ALPHA_COMBINE(d, a)         (uint8_t)((d) + (a) - ((uint32_t)(d) * (a) + 0x7F) / 0xFF)
+
+/**
+ * \brief           Convert character to alpha map with one byte per pixel
+ *
+ *                  Alpha values are combined with existing map content the same way
+ *                  as characters drawn one over another, so that multiple characters,
+ *                  also overlapping ones with kerning, may be rendered to the same map
+ *
+ * \param[in]       font: Font for character
+ * \param[in]       c: Character descriptor
+ * \param[out]      dst: Pointer to top left alpha value of character in map
+ * \param[in]       stride: Map line length in units of bytes
+ */
+void
+gui_text_getcharalpha(const gui_font_t* font, const gui_font_char_t* c, uint8_t* dst, size_t stride) {
+    gui_font_rle_t rle;
+    uint8_t row[0x100], y;
+
+    if (font->flags & GUI_FLAG_FONT_RLE) {
+        gui_text_rle_init(&rle, font, c);
+    }
+    for (y = 0; y < c->y_size; y++, dst += stride) {
+        gui_text_getcharrow(font, c, &rle, y, row);
+        gui_text_combinealpha(dst, stride, row, 0, c->x_size, 1);
+    }
+}
+
+/**
+ * \brief           Combine alpha map to another alpha map, the same way as overlapping characters
+ * \param[in,out]   dst: Pointer to top left value of destination map
+ * \param[in]       dst_stride: Destination map line length in units of bytes
+ * \param[in]       src: Pointer to top left value of source map
+ * \param[in]       src_stride: Source map line length in units of bytes
+ * \param[in]       width: Number of values in line to combine
+ * \param[in]       height: Number of lines to combine
+ */
+void
+gui_text_combinealpha(uint8_t* dst, size_t dst_stride, const uint8_t* src, size_t src_stride, gui_dim_t width, gui_dim_t height) {
+    gui_dim_t x;
+
+    for (; height > 0; height--, dst += dst_stride, src += src_stride) {
+        for (x = 0; x < width; x++) {
+            if (src[x]) {
+                dst[x] = ALPHA_COMBINE(dst[x], src[x]);
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Create new entry for character map and put it to glyph cache
+ *
+ *                  Least recently used entries are evicted when new entry does not fit into cache budget
+ *
  * \param[in]       font: Font for character
  * \param[in]       c: Character descriptor
  * \return          Character entry on success, `NULL` otherwise
@@ -109,77 +654,242 @@ gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c) {
 gui_font_charentry_t *
 gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c) {
     gui_font_charentry_t* entry = NULL;
-    size_t columns, memDataSize, memsize;
+    size_t memDataSize, memsize, i;
 
     /* Calculate memory size for data */
     memsize = GUI_MEM_ALIGN(sizeof(*entry));
     memDataSize = (size_t)c->x_size * (size_t)c->y_size;
     memsize += GUI_MEM_ALIGN(memDataSize);          /* Align memory before increase */
+    if (!cache_makeroom(memsize)) {                 /* Glyph is larger than entire cache */
+        return NULL;
+    }
     entry = GUI_MEMALLOC(memsize);                  /* Allocate memory for entry */
     if (entry != NULL) {                            /* Allocation was successful */
-        uint16_t i, x;
-        uint8_t b, k, t;
         uint8_t* ptr = (uint8_t *)entry;            /* Go to memory size */
 
+        GUI_MEMTAG(entry, GUI_MEM_TAG_GLYPH);
         ptr += GUI_MEM_ALIGN(sizeof(*entry));       /* Go to start of data, at the end of aligned structure size */
 
         entry->ch = c;                              /* Set pointer to character */
         entry->font = font;                         /* Set pointer to font structure */
+        entry->size = memsize;
+        gui_text_getcharalpha(font, c, ptr, c->x_size); /* Convert character to alpha map */
+
+        /* Add entry to hash table and as most recently used */
+        for (i = cache_slot(font, c); cache_table[i] != NULL; i = (i + 1) & CACHE_MASK) {}
+        cache_table[i] = entry;
+        gui_linkedlist_add_gen(&cache_lru, &entry->list);
+        cache_stats.used += memsize;
+        cache_stats.entries++;
+        if (cache_stats.used > cache_stats.used_max) {
+            cache_stats.used_max = cache_stats.used;
+        }
+    }
+    return entry;
+}
+
+/**
+ * \brief           Get character converted to alpha map with one byte per pixel
+ *
+ *                  Character is taken from font atlas when font has one,
+ *                  otherwise from glyph cache, where it is added when not cached yet
+ *
+ * \param[in]       font: Font for character
+ * \param[in]       c: Character descriptor
+ * \param[out]      stride: Map line length in units of bytes
+ * \return          Pointer to top left alpha value of character on success, `NULL` otherwise
+ */
+const uint8_t *
+gui_text_getcharmap(const gui_font_t* font, const gui_font_char_t* c, size_t* stride) {
+    gui_font_charentry_t* entry;
+#if GUI_CFG_USE_FONT_ATLAS
+    gui_font_atlas_t* atlas;
+
+    if ((atlas = atlas_get(font)) != NULL) {
+        *stride = atlas->width;
+        return atlas->data + atlas->offsets[c - font->data];
+    }
+#endif /* GUI_CFG_USE_FONT_ATLAS */
+
+    entry = gui_text_getcharentry(font, c);
+    if (entry == NULL) {
+        entry = gui_text_createcharentry(font, c);
+    }
+    if (entry == NULL) {
+        return NULL;
+    }
+    *stride = c->x_size;
+    return (const uint8_t *)entry + GUI_MEM_ALIGN(sizeof(*entry));
+}
+
+#if GUI_CFG_USE_FONT_ATLAS || __DOXYGEN__
+
+/**
+ * \brief           Pack all characters of font to single alpha texture
+ *
+ *                  Characters are placed on shelves from left to right, in order of font character array.
+ *                  Characters of font with atlas are not decoded again and are not stored in glyph cache
+ *
+ * \note            Texture memory is allocated from GUI memory and is not part of glyph cache budget
+ * \param[in]       font: Font to pack
+ * \param[in]       width: Texture width in units of pixels. Set to `0` to use default width of `256` pixels
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_text_createatlas(const gui_font_t* font, size_t width) {
+    gui_font_atlas_t* atlas = NULL;
+    const gui_font_char_t* c;
+    size_t count, hdr, i, x, y, h;
+    uint8_t pass;
+
+    GUI_ASSERTPARAMS(font != NULL);
+    if (atlas_get(font) != NULL) {                  /* Font is already packed */
+        return 1;
+    }
+    for (i = 0; i < GUI_CFG_FONT_ATLAS_COUNT && atlas == NULL; i++) {
+        if (atlases[i].font == NULL) {
+            atlas = &atlases[i];
+        }
+    }
+    if (atlas == NULL) {
+        return 0;
+    }
+    if (width == 0) {
+        width = 256;
+    }
 
-        if (font->flags & GUI_FLAG_FONT_AA) {       /* Anti-alliased font */
-            columns = c->x_size >> 2;               /* Calculate number of bytes used for single character line */
-            if (c->x_size % 4) {                    /* If only 1 column used */
-                columns++;
+    /* Number of characters in font */
+    if (font->ranges != NULL && font->ranges_count > 0) {
+        count = font->ranges[font->ranges_count - 1].index + (font->ranges[font->ranges_count - 1].last - font->ranges[font->ranges_count - 1].first) + 1;
+    } else {
+        count = (size_t)(font->endchar - font->startchar) + 1;
+    }
+
+    /* First pass gets texture height, second one converts characters */
+    hdr = GUI_MEM_ALIGN(count * sizeof(*atlas->offsets));
+    for (pass = 0; pass < 2; pass++) {
+        for (i = 0, x = 0, y = 0, h = 0, c = font->data; i < count; i++, c++) {
+            if (c->x_size > width) {
+                return 0;
             }
-            x = 0;
-            for (i = 0; i < c->y_size * columns; i++) { /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
-                for (k = 0; k < 4; k++) {           /* Scan each bit in byte */
-                    t = (b >> (6 - 2 * k)) & 0x03;  /* Get temporary bits on bottom */
-                    switch (t) {
-                        case 0:
-                            *ptr |= 0x00;
-                            break;
-                        case 1:
-                            *ptr |= 0x55;
-                            break;
-                        case 2:
-                            *ptr |= 0xAA;
-                            break;
-                        default:
-                            *ptr |= 0xFF;
-                    }
-                    ptr++;
-                    x++;
-                    if (x == c->x_size) {
-                        x = 0;
-                        break;
-                    }
-                }
+            if (x + c->x_size > width) {            /* Start new shelf */
+                x = 0;
+                y += h;
+                h = 0;
             }
-        } else {
-            columns = c->x_size >> 3;               /* Calculate number of bytes used for single character line */
-            if (c->x_size % 8) {                    /* If only 1 column used */
-                columns++;
+            if (pass) {
+                atlas->offsets[i] = (uint32_t)(y * width + x);
+                gui_text_getcharalpha(font, c, atlas->data + atlas->offsets[i], width);
             }
-            x = 0;
-            for (i = 0; i < c->y_size * columns; i++) { /* Inspect all vertical lines */
-                b = c->data[i];                     /* Get byte of data */
-                for (k = 0; k < 8; k++) {           /* Scan each bit in byte */
-                    if ((b >> (7 - k)) & 0x01) {
-                        *ptr++ = 0xFF;
-                    } else {
-                        *ptr++ = 0x00;
-                    }
-                    x++;
-                    if (x == c->x_size) {
-                        x = 0;
-                        break;
-                    }
-                }
+            x += c->x_size;
+            h = GUI_MAX(h, c->y_size);
+        }
+        if (!pass) {
+            atlas->offsets = GUI_MEMALLOC(hdr + width * (y + h));   /* Texture must be cleared */
+            if (atlas->offsets == NULL) {
+                return 0;
             }
+            GUI_MEMTAG(atlas->offsets, GUI_MEM_TAG_GLYPH);
+            atlas->data = (uint8_t *)atlas->offsets + hdr;
+            atlas->width = width;
+            atlas->height = y + h;
         }
-        gui_linkedlist_add_gen(&GUI.root_fonts, (gui_linkedlist_t *)entry);  /* Add entry to linked list */
     }
-    return entry;
+    atlas->font = font;
+    return 1;
+}
+
+/**
+ * \brief           Remove atlas of font and free its memory
+ * \param[in]       font: Font to remove atlas for. Set to `NULL` to remove all atlases
+ */
+void
+gui_text_removeatlas(const gui_font_t* font) {
+    size_t i;
+
+    for (i = 0; i < GUI_CFG_FONT_ATLAS_COUNT; i++) {
+        if (atlases[i].font != NULL && (font == NULL || atlases[i].font == font)) {
+            cache_wait_ready();                     /* Atlas may be source of character copy in progress */
+            GUI_MEMFREE(atlases[i].offsets);
+            memset(&atlases[i], 0x00, sizeof(atlases[i]));
+        }
+    }
+}
+
+#endif /* GUI_CFG_USE_FONT_ATLAS || __DOXYGEN__ */
+
+/**
+ * \brief           Remove cached glyphs and character lookups of font
+ *
+ *                  Use this function before font data are released or changed.
+ *                  Font atlas is removed too, when enabled with \ref GUI_CFG_USE_FONT_ATLAS
+ *
+ * \param[in]       font: Font to remove glyphs for. Set to `NULL` to remove all glyphs
+ */
+void
+gui_text_removecache(const gui_font_t* font) {
+    gui_font_charentry_t *entry, *next;
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE || GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+    size_t i;
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE || GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+
+#if GUI_CFG_FONT_RANGE_CACHE_SIZE
+    for (i = 0; i < GUI_CFG_FONT_RANGE_CACHE_SIZE; i++) {
+        if (font == NULL || range_cache[i].font == font) {
+            range_cache[i].font = NULL;
+        }
+    }
+#endif /* GUI_CFG_FONT_RANGE_CACHE_SIZE */
+#if GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+    for (i = 0; i < GUI_CFG_FONT_ADVANCE_CACHE_SIZE; i++) {
+        if (font == NULL || advance_cache[i].font == font) {
+            advance_cache[i].font = NULL;
+            advance_cache[i].used = 0;              /* Replace free entry first */
+        }
+    }
+#endif /* GUI_CFG_FONT_ADVANCE_CACHE_SIZE */
+
+    for (entry = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(&cache_lru, NULL); entry != NULL; entry = next) {
+        next = (gui_font_charentry_t *)gui_linkedlist_getnext_gen(NULL, &entry->list);
+        if (font == NULL || entry->font == font) {
+            cache_free(entry);
+        }
+    }
+#if GUI_CFG_USE_FONT_ATLAS
+    gui_text_removeatlas(font);
+#endif /* GUI_CFG_USE_FONT_ATLAS */
+}
+
+/**
+ * \brief           Set maximal number of bytes used by cached glyphs
+ *
+ *                  When budget is decreased, least recently used glyphs are evicted immediately
+ *
+ * \param[in]       size: Budget in units of bytes
+ */
+void
+gui_text_setcachebudget(size_t size) {
+    cache_budget = size;
+    cache_makeroom(0);
+}
+
+/**
+ * \brief           Get glyph cache statistics
+ * \param[out]      s: Pointer to \ref gui_text_cachestats_t structure to fill
+ */
+void
+gui_text_getcachestats(gui_text_cachestats_t* s) {
+    *s = cache_stats;
+    s->budget = cache_budget;
+}
+
+/**
+ * \brief           Reset hit, miss and eviction counters and maximal used memory
+ */
+void
+gui_text_resetcachestats(void) {
+    cache_stats.hits = 0;
+    cache_stats.misses = 0;
+    cache_stats.evictions = 0;
+    cache_stats.used_max = cache_stats.used;
 }
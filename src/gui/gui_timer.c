@@ -54,8 +54,9 @@ gui_timer_t *
 guii_timer_create(uint16_t period, void (*callback)(gui_timer_t *), void* const params) {
     gui_timer_t* ptr;
     
-    ptr = GUI_MEMALLOC(sizeof(*ptr));               /* Allocate memory for timer */
+    ptr = GUI_MEMPOOLALLOC(sizeof(*ptr));           /* Allocate memory for timer */
     if (ptr != NULL) {
+        GUI_MEMPOOLTAG(ptr, GUI_MEM_TAG_TIMER);
         memset(ptr, 0x00, sizeof(*ptr));            /* Reset memory */
         
         ptr->period = period;                       /* Set period value */
@@ -84,7 +85,7 @@ uint8_t
 guii_timer_remove(gui_timer_t** const t) {  
     GUI_ASSERTPARAMS(t != NULL && *t != NULL);  
     gui_linkedlist_remove_gen(&GUI.timers.list, (gui_linkedlist_t *)(*t));  /* Remove timer from linked list */
-    GUI_MEMFREE(*t);                                /* Free memory for timer */
+    GUI_MEMPOOLFREE(*t);                            /* Free memory for timer */
     *t = NULL;                                      /* Clear pointer */
     
     return 1;
@@ -34,9 +34,118 @@
 #define GUI_INTERNAL
 #include "gui/gui_private.h"
 #include "gui/gui_translate.h"
+#include "widget/gui_widget.h"
 
 #if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
 
+#if GUI_CFG_USE_TRANSLATE_INDEX
+
+/**
+ * \brief           Calculate FNV-1a hash of string
+ * \param[in]       str: String to hash
+ * \return          Hash value
+ */
+static uint32_t
+translate_hash(const gui_char* str) {
+    uint32_t h = 0x811C9DC5UL;
+
+    for (; *str; str++) {
+        h = (h ^ *str) * 0x01000193UL;
+    }
+    return h;
+}
+
+/**
+ * \brief           Build hash index of source language entries
+ *
+ *                  Index has at least twice as many slots as there are entries,
+ *                  collisions are resolved with linear probing
+ */
+static void
+translate_build_index(void) {
+    const gui_translate_language_t* src = GUI.translate.source;
+    size_t i, k, size;
+
+    if (GUI.translate.index != NULL) {
+        GUI_MEMFREE(GUI.translate.index);
+        GUI.translate.index = NULL;
+    }
+    if (src == NULL || src->count == 0 || src->count >= 0xFFFF) {
+        return;                                     /* Linear search is used without index */
+    }
+    for (size = 4; size < 2 * src->count; size <<= 1) {}
+    if ((GUI.translate.index = GUI_MEMALLOC(size * sizeof(*GUI.translate.index))) == NULL) {
+        return;
+    }
+    GUI_MEMTAG(GUI.translate.index, GUI_MEM_TAG_TEXT);
+    GUI.translate.index_mask = size - 1;
+    for (i = 0; i < src->count; i++) {
+        if (src->entries[i] == NULL) {
+            continue;
+        }
+        for (k = translate_hash(src->entries[i]) & GUI.translate.index_mask;
+            GUI.translate.index[k]; k = (k + 1) & GUI.translate.index_mask) {}
+        GUI.translate.index[k] = (uint16_t)(i + 1);
+    }
+}
+
+#endif /* GUI_CFG_USE_TRANSLATE_INDEX */
+
+/**
+ * \brief           Find index of string in source language
+ * \param[in]       src: String to find
+ * \return          Entry index or number of source entries if not found
+ */
+static size_t
+translate_find(const gui_char* const src) {
+    const gui_translate_language_t* lang = GUI.translate.source;
+    size_t i;
+
+#if GUI_CFG_USE_TRANSLATE_INDEX
+    if (GUI.translate.index != NULL) {
+        for (i = translate_hash(src) & GUI.translate.index_mask;
+            GUI.translate.index[i]; i = (i + 1) & GUI.translate.index_mask) {
+            const gui_char* e = lang->entries[GUI.translate.index[i] - 1];
+            if (e == src || gui_string_compare(src, e) == 0) {
+                return GUI.translate.index[i] - 1;
+            }
+        }
+        return lang->count;
+    }
+#endif /* GUI_CFG_USE_TRANSLATE_INDEX */
+
+    /* Scan all entries */
+    for (i = 0; i < lang->count; i++) {
+        if (lang->entries[i] != NULL && gui_string_compare(src, lang->entries[i]) == 0) {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * \brief           Redraw all widgets with translated texts after language change
+ *
+ *                  Widgets with text set by ID get text of new language in the same pass
+ *
+ * \param[in]       parent: Parent widget of widgets to process
+ */
+static void
+translate_update_widgets(gui_handle_p parent) {
+    gui_handle_p h;
+
+    GUI_LINKEDLIST_WIDGETSLISTNEXT(parent, h) {
+        if (guii_widget_getflag(h, GUI_FLAG_TEXTID)) {
+            gui_widget_settextid(h, h->textid);     /* Set text of new language */
+        } else if (h->text != NULL && !guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {
+            gui_widget_invalidate(h);               /* Text is translated when drawn */
+        }
+        if (guii_widget_allowchildren(h)) {
+            translate_update_widgets(h);
+        }
+    }
+}
+
 /**
  * \brief           Get translated entry from input string
  * \param[in]       src: String to translate
@@ -51,39 +160,64 @@ gui_translate_get(const gui_char* const src) {
         return src;                                 /* Just return original string */
     }
     
-    /* Scan all entries and return appropriate string */
-    for (i = 0; i < GUI.translate.source->count; i++) {
-        if (gui_string_compare(src, GUI.translate.source->entries[i]) == 0) {
-            if (i < GUI.translate.active->count) {  /* Check if in valid range */
-                return GUI.translate.active->entries[i];    /* Return translated string */
-            }
-            break;                                  /* Stop execution at this point */
-        }
+    i = translate_find(src);                        /* Get index of source entry */
+    if (i < GUI.translate.source->count && i < GUI.translate.active->count
+        && GUI.translate.active->entries[i] != NULL) {  /* Check if in valid range */
+        return GUI.translate.active->entries[i];    /* Return translated string */
     }
     return src;                                     /* Return main source */
 }
 
+/**
+ * \brief           Get translated entry by ID
+ *
+ *                  ID is index of entry in source language table.
+ *                  Enumeration of IDs can be generated from source table with `tools/trid` host tool
+ *
+ * \param[in]       id: Translation ID
+ * \return          Pointer to string in active language, string from source language when translation is missing
+ *                  or `NULL` when ID is not valid
+ */
+const gui_char*
+gui_translate_getid(size_t id) {
+    if (GUI.translate.active != NULL && id < GUI.translate.active->count
+        && GUI.translate.active->entries[id] != NULL) {
+        return GUI.translate.active->entries[id];
+    }
+    if (GUI.translate.source != NULL && id < GUI.translate.source->count) {
+        return GUI.translate.source->entries[id];
+    }
+    return NULL;
+}
+
 /**
  * \brief           Set currently active language for translated entries
  * \note            These entries are returned when index matches the source string from source language
+ * \note            All widgets with translated texts are redrawn
  * \param[in]       lang: Language with translation entries
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_translate_setactivelanguage(const gui_translate_language_t* const lang) {
     GUI.translate.active = lang;                    /* Set currently active language */
+    translate_update_widgets(NULL);                 /* Update widget texts */
     return 1;
 }
 
 /**
  * \brief           Set source language for translated entries
- * \note            These entries are compared with input string to get index for translated value
+ * \note            These entries are compared with input string to get index for translated value.
+ *                  When \ref GUI_CFG_USE_TRANSLATE_INDEX is enabled, hash index of entries is built
  * \param[in]       lang: Language with translation entries
  * \return          `1` on success, `0` otherwise
  */
 uint8_t
 gui_translate_setsourcelanguage(const gui_translate_language_t* const lang) {
     GUI.translate.source = lang;                    /* Set source language */
+#if GUI_CFG_USE_TRANSLATE_INDEX
+    translate_build_index();                        /* Build hash index of entries */
+#endif /* GUI_CFG_USE_TRANSLATE_INDEX */
+    translate_update_widgets(NULL);                 /* Update widget texts */
     return 1;
 }
 
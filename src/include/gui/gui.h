@@ -62,6 +62,8 @@ extern "C" {
 #include "gui/gui_math.h"
 #include "gui/gui_mem.h"
 #include "gui/gui_translate.h"
+#include "gui/gui_imagecache.h"
+#include "gui/gui_asset.h"
 
 /* GUI Low-Level drivers */
 #include "system/gui_ll.h"
@@ -113,6 +115,98 @@ extern "C" {
     (p) = NULL;                                     \
 } while (0)
 
+/**
+ * \brief           Set allocation tag of memory previously allocated with \ref GUI_MEMALLOC or \ref GUI_MEMREALLOC
+ * \note            Tag is evaluated only when \ref GUI_CFG_USE_MEM_TAG is enabled
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_TAG || __DOXYGEN__
+#define GUI_MEMTAG(p, tag)          gui_mem_settag(p, tag)
+#else /* GUI_CFG_USE_MEM_TAG || __DOXYGEN__ */
+#define GUI_MEMTAG(p, tag)
+#endif /* !(GUI_CFG_USE_MEM_TAG || __DOXYGEN__) */
+
+/**
+ * \brief           Allocate memory for fixed size object from pool of blocks with the same size
+ * \note            Memory is not reset to zero when pools are enabled and must be freed with \ref GUI_MEMPOOLFREE
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_POOL || __DOXYGEN__
+#define GUI_MEMPOOLALLOC(size)      gui_mem_pool_alloc(size)
+#else /* GUI_CFG_USE_MEM_POOL || __DOXYGEN__ */
+#define GUI_MEMPOOLALLOC(size)      GUI_MEMALLOC(size)
+#endif /* !(GUI_CFG_USE_MEM_POOL || __DOXYGEN__) */
+
+/**
+ * \brief           Allocate memory for fixed size object from pool and reset it to zero
+ * \note            Memory must be freed with \ref GUI_MEMPOOLFREE
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_POOL || __DOXYGEN__
+#define GUI_MEMPOOLCALLOC(size)     gui_mem_pool_calloc(size)
+#else /* GUI_CFG_USE_MEM_POOL || __DOXYGEN__ */
+#define GUI_MEMPOOLCALLOC(size)     GUI_MEMALLOC(size)
+#endif /* !(GUI_CFG_USE_MEM_POOL || __DOXYGEN__) */
+
+/**
+ * \brief           Free memory previously allocated with \ref GUI_MEMPOOLALLOC
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_POOL || __DOXYGEN__
+#define GUI_MEMPOOLFREE(p)          do {            \
+    gui_mem_pool_free(p);                           \
+    (p) = NULL;                                     \
+} while (0)
+#else /* GUI_CFG_USE_MEM_POOL || __DOXYGEN__ */
+#define GUI_MEMPOOLFREE(p)          GUI_MEMFREE(p)
+#endif /* !(GUI_CFG_USE_MEM_POOL || __DOXYGEN__) */
+
+/**
+ * \brief           Set allocation tag of memory allocated with \ref GUI_MEMPOOLALLOC
+ * \note            Pool objects are counted in \ref GUI_MEM_TAG_POOL tag when pools are enabled
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_POOL || __DOXYGEN__
+#define GUI_MEMPOOLTAG(p, tag)
+#else /* GUI_CFG_USE_MEM_POOL || __DOXYGEN__ */
+#define GUI_MEMPOOLTAG(p, tag)      GUI_MEMTAG(p, tag)
+#endif /* !(GUI_CFG_USE_MEM_POOL || __DOXYGEN__) */
+
+/**
+ * \brief           Allocate memory used only until the end of current redraw from frame arena
+ * \note            Memory is reset to zero and must be freed with \ref GUI_MEMFRAMEFREE before redraw ends
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+#define GUI_MEMFRAMEALLOC(size)     gui_mem_frame_alloc(size)
+#else /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+#define GUI_MEMFRAMEALLOC(size)     GUI_MEMALLOC(size)
+#endif /* !(GUI_CFG_USE_MEM_FRAME || __DOXYGEN__) */
+
+/**
+ * \brief           Free memory previously allocated with \ref GUI_MEMFRAMEALLOC
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+#define GUI_MEMFRAMEFREE(p)         do {            \
+    gui_mem_frame_free(p);                          \
+    (p) = NULL;                                     \
+} while (0)
+#else /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+#define GUI_MEMFRAMEFREE(p)         GUI_MEMFREE(p)
+#endif /* !(GUI_CFG_USE_MEM_FRAME || __DOXYGEN__) */
+
+/**
+ * \brief           Set allocation tag of memory allocated with \ref GUI_MEMFRAMEALLOC
+ * \note            Allocations, which do not fit into frame arena, are counted in \ref GUI_MEM_TAG_FRAME tag
+ * \hideinitializer
+ */
+#if GUI_CFG_USE_MEM_FRAME || __DOXYGEN__
+#define GUI_MEMFRAMETAG(p, tag)
+#else /* GUI_CFG_USE_MEM_FRAME || __DOXYGEN__ */
+#define GUI_MEMFRAMETAG(p, tag)     GUI_MEMTAG(p, tag)
+#endif /* !(GUI_CFG_USE_MEM_FRAME || __DOXYGEN__) */
+
 /**
  * \brief           Get maximal value between 2 values
  * \param[in]       x: First value
@@ -188,6 +282,7 @@ extern "C" {
 
 /* Include widget structure */
 #include "widget/gui_widget.h"
+#include "gui/gui_effect.h"
 #include "gui/gui_input.h"
 
 guir_t      gui_init(void);
@@ -0,0 +1,109 @@
+/**	
+ * \file            gui_asset.h
+ * \brief           Binary font and image assets
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_ASSET_H
+#define GUI_HDR_ASSET_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_ASSET Binary assets
+ * \brief           Fonts and images loaded from binary files instead of compiled-in arrays
+ *
+ * Asset file starts with header, followed by type specific section.
+ * All values are little endian and all offsets are from start of file.
+ *
+ * Header, `16` bytes:
+ *
+ *  - `0`: Magic `EGUI`
+ *  - `4`: `uint8_t` version, set to `2`. Version `1` files without kerning are supported too
+ *  - `5`: `uint8_t` type, \ref gui_asset_type_t
+ *  - `6`: `uint16_t` reserved
+ *  - `8`: `uint32_t` data region offset, must be multiple of `4`
+ *  - `12`: `uint32_t` data region size
+ *
+ * Font section, starting at offset `16`:
+ *
+ *  - `16`: `uint8_t` size, `uint8_t` flags, `uint16_t` reserved
+ *  - `20`: `uint32_t` start character, `uint32_t` end character
+ *  - `28`: `uint32_t` number of characters, `uint32_t` number of ranges
+ *  - `36`: `uint32_t` offset of `NULL` terminated name
+ *  - `40`: `uint32_t` offset of character table, `uint32_t` offset of range table
+ *  - `48`: `uint32_t` number of kerning pairs, `uint32_t` offset of kerning table. Not present in version `1`
+ *
+ * Character table entry is `16` bytes: `x_size`, `y_size`, `x_pos`, `y_pos`, `x_margin`,
+ * `3` reserved bytes, `uint32_t` data offset and `uint32_t` data size.
+ * Range table entry is `12` bytes: `uint32_t` first, `uint32_t` last and `uint32_t` index.
+ * Ranges are optional, check \ref gui_font_range_t.
+ * Kerning table entry is `6` bytes: `uint16_t` first and `uint16_t` second character index,
+ * `int8_t` value and `1` reserved byte. Pairs must be sorted, check \ref gui_font_kern_t.
+ *
+ * Image section, starting at offset `16`:
+ *
+ *  - `16`: `uint16_t` width, `uint16_t` height
+ *  - `20`: `uint8_t` bits per pixel, `uint8_t` reserved, `uint16_t` number of CLUT entries
+ *  - `24`: `uint32_t` image offset, `uint32_t` image size
+ *  - `32`: `uint32_t` CLUT offset, must be multiple of `4`, `0` when not used
+ *
+ * Font name, character data, image data and CLUT must be inside data region.
+ * Data region is used in place when asset is in addressable memory,
+ * glyphs and images are drawn directly from it without copy.
+ *
+ * \{
+ */
+
+uint8_t         gui_asset_load(gui_asset_t* asset, const void* data, size_t len);
+uint8_t         gui_asset_loadread(gui_asset_t* asset, gui_asset_read_fn read_fn, void* arg);
+#if GUI_CFG_ASSET_MMAP || __DOXYGEN__
+uint8_t         gui_asset_open(gui_asset_t* asset, const char* path);
+#endif /* GUI_CFG_ASSET_MMAP || __DOXYGEN__ */
+void            gui_asset_unload(gui_asset_t* asset);
+const gui_font_t*       gui_asset_getfont(const gui_asset_t* asset);
+const gui_image_desc_t* gui_asset_getimage(const gui_asset_t* asset);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_ASSET_H */
@@ -126,6 +126,19 @@
 #define GUI_CFG_USE_TRANSLATE                   1
 #endif
 
+/**
+ * \brief           Enables (1) or disables (0) hash index of source language for \ref gui_translate_get
+ *
+ *                  Index is allocated when source language is set and uses
+ *                  up to `8` bytes of dynamic memory per source entry.
+ *                  When disabled or when allocation fails, source entries are compared one by one
+ *
+ * \note            Translations by ID with \ref gui_translate_getid do not need index
+ */
+#ifndef GUI_CFG_USE_TRANSLATE_INDEX
+#define GUI_CFG_USE_TRANSLATE_INDEX             0
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) library custom allocation algorithm.
  *      
@@ -148,6 +161,113 @@
 #define GUI_CFG_MEM_ALIGNMENT                   4
 #endif
 
+/**
+ * \brief           Enables (1) or disables (0) two-level segregated fit (TLSF) allocation algorithm
+ *
+ *                  When enabled, free blocks are kept in lists by size class
+ *                  and allocation and free operations take constant time, independent of heap fragmentation.
+ *                  When disabled, first fit search over list of free blocks sorted by address is used
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM is enabled.
+ *                  Blocks are limited to `32 MB`, bigger regions are truncated
+ */
+#ifndef GUI_CFG_USE_MEM_TLSF
+#define GUI_CFG_USE_MEM_TLSF                    0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) pools of fixed size blocks
+ *
+ *                  Widgets, timers and list items are allocated from pools, one pool per object size.
+ *                  Pool takes slabs of \ref GUI_CFG_MEM_POOL_BLOCKS blocks from main heap,
+ *                  allocation takes first free block of first slab with free space
+ *                  and free operation finds slab by pointer stored in front of block.
+ *                  Main heap gets less and bigger blocks, at the cost of partially used slabs
+ */
+#ifndef GUI_CFG_USE_MEM_POOL
+#define GUI_CFG_USE_MEM_POOL                    0
+#endif
+
+/**
+ * \brief           Maximal number of pools, each pool serves one block size
+ *
+ *                  When all pools are in use, objects of new sizes are allocated from main heap
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_POOL is enabled
+ */
+#ifndef GUI_CFG_MEM_POOL_COUNT
+#define GUI_CFG_MEM_POOL_COUNT                  16
+#endif
+
+/**
+ * \brief           Number of blocks in single slab of pool, between `1` and `32`
+ * \note            Used only when \ref GUI_CFG_USE_MEM_POOL is enabled
+ */
+#ifndef GUI_CFG_MEM_POOL_BLOCKS
+#define GUI_CFG_MEM_POOL_BLOCKS                 32
+#endif
+
+/**
+ * \brief           Minimal number of empty slabs each pool keeps for next allocations
+ *
+ *                  Pool also keeps as many empty slabs as needed to hold currently used blocks again.
+ *                  Surplus empty slabs are returned to main heap when slab gets empty.
+ *                  Kept slabs avoid taking slab from main heap and returning it back
+ *                  when objects are created and deleted repeatedly, for example on screen switch
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_POOL is enabled
+ */
+#ifndef GUI_CFG_MEM_POOL_KEEP_SLABS
+#define GUI_CFG_MEM_POOL_KEEP_SLABS             0
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) allocation tags
+ *
+ *                  Every block keeps tag of subsystem or widget type it belongs to
+ *                  and live bytes, count and maximal bytes are counted per tag.
+ *                  Costs one byte of metadata per block, rounded up to \ref GUI_CFG_MEM_ALIGNMENT
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM is enabled
+ */
+#ifndef GUI_CFG_USE_MEM_TAG
+#define GUI_CFG_USE_MEM_TAG                     0
+#endif
+
+/**
+ * \brief           Maximal number of tags, including built-in ones.
+ *
+ *                  Widget types and user tags are added in order of first use,
+ *                  when all tags are in use, blocks are counted in \ref GUI_MEM_TAG_OTHER tag
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_TAG is enabled, maximal value is `255`
+ */
+#ifndef GUI_CFG_MEM_TAG_COUNT
+#define GUI_CFG_MEM_TAG_COUNT                   32
+#endif
+
+/**
+ * \brief           Enables (1) or disables (0) frame arena for memory used only during redraw
+ *
+ *                  Virtual layers of transparent widgets and temporary buffers of effects
+ *                  are allocated from static arena with bump pointer, released at the end of every redraw.
+ *                  Allocations, which do not fit into arena, are made from main heap
+ */
+#ifndef GUI_CFG_USE_MEM_FRAME
+#define GUI_CFG_USE_MEM_FRAME                   0
+#endif
+
+/**
+ * \brief           Size of frame arena in units of bytes
+ *
+ *                  Maximal size needed by application can be read with \ref gui_mem_frame_getinfo
+ *
+ * \note            Used only when \ref GUI_CFG_USE_MEM_FRAME is enabled
+ */
+#ifndef GUI_CFG_MEM_FRAME_SIZE
+#define GUI_CFG_MEM_FRAME_SIZE                  4096
+#endif
+
 /**
  * \brief           Enables (1) or disables (0) alpha option for widgets
  *
@@ -224,6 +344,216 @@ gui_widget_setignoreinvalidate(h, 0, 1, 0);
 #define GUI_CFG_LONG_CLICK_TIMEOUT              1500
 #endif
 
+/**
+ * \brief           Enables `1` or disables `0` palette-indexed images
+ *
+ *                  When enabled, images with `8` or `4` bits per pixel and
+ *                  color look-up table (CLUT) can be drawn.
+ *                  Low-level `DrawImageIndexed` function is used when available,
+ *                  otherwise image is expanded with software using palette,
+ *                  prepared once in destination pixel format.
+ *
+ * \note            Software path requires additional `1024` bytes of RAM for prepared palette
+ */
+#ifndef GUI_CFG_USE_IMAGE_INDEXED
+#define GUI_CFG_USE_IMAGE_INDEXED               1
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` cache for decoded images
+ *
+ *                  Images from compressed or external sources are decoded
+ *                  once to GUI memory and reused on next redraws
+ *
+ * \sa              GUI_CFG_IMAGE_CACHE_SIZE
+ */
+#ifndef GUI_CFG_USE_IMAGE_CACHE
+#define GUI_CFG_USE_IMAGE_CACHE                 0
+#endif
+
+/**
+ * \brief           Maximal number of bytes used for decoded images
+ *
+ *                  Least recently used images are evicted when new image does not fit
+ *
+ * \note            Memory is allocated from GUI memory, \ref GUI_CFG_USE_MEM
+ */
+#ifndef GUI_CFG_IMAGE_CACHE_SIZE
+#define GUI_CFG_IMAGE_CACHE_SIZE                32768
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` fonts and images loaded from binary asset files
+ *
+ *                  Assets can be used in place from addressable memory or
+ *                  copied to GUI memory with block read function
+ *
+ * \sa              GUI_CFG_ASSET_MMAP
+ */
+#ifndef GUI_CFG_USE_ASSET
+#define GUI_CFG_USE_ASSET                       0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` loading asset files by path with `mmap`
+ *
+ * \note            Requires POSIX system with memory mapped files, such as Linux
+ */
+#ifndef GUI_CFG_ASSET_MMAP
+#define GUI_CFG_ASSET_MMAP                      0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` ordered dither for 16-bit layers
+ *
+ *                  When enabled, true color images and gradients are dithered with 4x4 Bayer matrix
+ *                  when drawn to RGB565 layer, to prevent visible color banding.
+ *
+ * \note            Dither is done with software, which replaces low-level image drawing
+ *                  of 24 and 32 bits per pixel images on 16-bit layers
+ */
+#ifndef GUI_CFG_USE_DITHER
+#define GUI_CFG_USE_DITHER                      0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` drop shadow and backdrop blur effects on widgets
+ *
+ *                  Shadow profile and blurred backdrop are cached in GUI memory per widget
+ *                  and recalculated only when content under widget is redrawn
+ *
+ * \note            Effects are done with software and require direct access to drawing layer memory
+ */
+#ifndef GUI_CFG_USE_EFFECTS
+#define GUI_CFG_USE_EFFECTS                     0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` text layout cache on widgets
+ *
+ *                  Line breaks and line widths of widget text are calculated once
+ *                  and reused on next redraws, until text, font, box width or text flags change.
+ *
+ * \note            Each widget with text requires additional memory for layout of its lines
+ */
+#ifndef GUI_CFG_USE_TEXT_LAYOUT
+#define GUI_CFG_USE_TEXT_LAYOUT                 0
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` pre-rendered text runs
+ *
+ *                  Text with cached layout is rendered once to `A8` alpha map
+ *                  and drawn with single alpha blending operation per color on next redraws.
+ *
+ * \note            Requires \ref GUI_CFG_USE_TEXT_LAYOUT to be enabled
+ * \sa              GUI_CFG_TEXT_RUN_MAX_SIZE
+ */
+#ifndef GUI_CFG_USE_TEXT_RUN
+#define GUI_CFG_USE_TEXT_RUN                    0
+#endif
+
+/**
+ * \brief           Maximal number of bytes for single pre-rendered text run
+ *
+ *                  Larger texts, such as long multi-line views, are drawn character by character
+ */
+#ifndef GUI_CFG_TEXT_RUN_MAX_SIZE
+#define GUI_CFG_TEXT_RUN_MAX_SIZE               4096
+#endif
+
+/**
+ * \brief           Maximal number of bytes used for glyphs converted to alpha maps
+ *
+ *                  Glyphs are converted to `1` byte per pixel alpha map once and reused on next drawings,
+ *                  with low-level `CopyChar` function when available or with built-in software blit otherwise.
+ *                  Least recently used glyphs are evicted when new glyph does not fit
+ *
+ * \note            Memory is allocated from GUI memory, \ref GUI_CFG_USE_MEM
+ */
+#ifndef GUI_CFG_FONT_CACHE_SIZE
+#define GUI_CFG_FONT_CACHE_SIZE                 8192
+#endif
+
+/**
+ * \brief           Number of slots in glyph cache hash table
+ *
+ *                  At most `3/4` of slots are used at a time, to keep lookups short.
+ *
+ * \note            Value must be power of 2
+ */
+#ifndef GUI_CFG_FONT_CACHE_SLOTS
+#define GUI_CFG_FONT_CACHE_SLOTS                128
+#endif
+
+/**
+ * \brief           Number of fonts with advance width table built in RAM
+ *
+ *                  Widths of characters `0x20 - 0x7F` are taken from table,
+ *                  for fonts without table in font structure.
+ *                  Table of least recently used font is replaced when all are in use.
+ *                  Set to `0` to always get widths from character descriptors
+ */
+#ifndef GUI_CFG_FONT_ADVANCE_CACHE_SIZE
+#define GUI_CFG_FONT_ADVANCE_CACHE_SIZE         4
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` font atlases
+ *
+ *                  All characters of font are packed to single alpha texture with \ref gui_text_createatlas,
+ *                  to be used instead of glyph cache for fonts which are used the most
+ *
+ * \sa              GUI_CFG_FONT_ATLAS_COUNT
+ */
+#ifndef GUI_CFG_USE_FONT_ATLAS
+#define GUI_CFG_USE_FONT_ATLAS                  0
+#endif
+
+/**
+ * \brief           Maximal number of fonts with atlas at a time
+ */
+#ifndef GUI_CFG_FONT_ATLAS_COUNT
+#define GUI_CFG_FONT_ATLAS_COUNT                2
+#endif
+
+/**
+ * \brief           Enables `1` or disables `0` composition of text lines
+ *
+ *                  Characters of each visible line are combined to `A8` line buffer first
+ *                  and line is drawn with single alpha blending operation per color,
+ *                  instead of one low-level `CopyChar` call per character.
+ *
+ *                  Lines are composed only when low-level `CopyChar` function is available,
+ *                  as built-in software blit does not have per-transfer overhead
+ *
+ * \sa              GUI_CFG_TEXT_LINE_SIZE
+ */
+#ifndef GUI_CFG_USE_TEXT_LINE
+#define GUI_CFG_USE_TEXT_LINE                   0
+#endif
+
+/**
+ * \brief           Number of bytes of text line buffer
+ *
+ *                  Lines with larger visible area are drawn character by character
+ */
+#ifndef GUI_CFG_TEXT_LINE_SIZE
+#define GUI_CFG_TEXT_LINE_SIZE                  4096
+#endif
+
+/**
+ * \brief           Number of entries in direct-mapped cache of recent character lookups
+ *                  in fonts with character ranges
+ *
+ *                  Set to `0` to disable cache and always search ranges
+ *
+ * \note            Value must be power of 2
+ */
+#ifndef GUI_CFG_FONT_RANGE_CACHE_SIZE
+#define GUI_CFG_FONT_RANGE_CACHE_SIZE           32
+#endif
+
 #ifndef GUI_CFG_SYS_PORT
 #define GUI_CFG_SYS_PORT                        GUI_SYS_PORT_CMSIS_OS
 #endif
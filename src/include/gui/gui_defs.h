@@ -83,6 +83,7 @@ extern "C" {
 #define GUI_FLAG_IGNORE_INVALIDATE          ((uint32_t)0x00004000)  /*!< Indicates widget invalidation is ignored completely when invalidating it directly */
 #define GUI_FLAG_FIRST_INVALIDATE           ((uint32_t)0x00008000)  /*!< Indicates widget is invalidated for "first" time, thus ignore check if parent is hidden or not */
 #define GUI_FLAG_TOUCH_MOVE                 ((uint32_t)0x00010000)  /*!< Indicates widget callback has processed touch move event. This parameter works in conjunction with \ref GUI_FLAG_ACTIVE flag */
+#define GUI_FLAG_TEXTID                     ((uint32_t)0x00020000)  /*!< Indicates widget text is set by translation ID, check \ref gui_widget_settextid */
 
 /**
  * \}
@@ -376,7 +377,8 @@ typedef struct {
     uint8_t num;                            /*!< Layer number */
     void* start_address;                    /*!< Start address in memory if it exists */
     volatile uint8_t pending;               /*!< Layer pending for redrawing operation */
-    gui_display_t display;                  /*!< Display setup for clipping regions for main layers (no virtual) */
+    gui_display_t display;                  /*!< Display setup for clipping regions for main layers (no virtual).
+                                                It is set before layer is passed to low-level as active layer */
     
     gui_dim_t width;                        /*!< Layer width, used for virtual layers mainly */
     gui_dim_t height;                       /*!< Layer height, used for virtual layers mainly */
@@ -384,12 +386,24 @@ typedef struct {
     gui_dim_t y_pos;                        /*!< Absolute Y position on screen, used for virtual layers */
 } gui_layer_t;
 
+/**
+ * \brief           LCD orientation, clockwise rotation of drawn content on physical panel
+ */
+typedef enum {
+    GUI_LCD_ORIENTATION_0 = 0x00,           /*!< Content is drawn in panel native orientation */
+    GUI_LCD_ORIENTATION_90,                 /*!< Content is rotated by `90` degrees, top-left pixel is shown in top-right panel corner */
+    GUI_LCD_ORIENTATION_180,                /*!< Content is rotated by `180` degrees */
+    GUI_LCD_ORIENTATION_270,                /*!< Content is rotated by `270` degrees, top-left pixel is shown in bottom-left panel corner */
+} gui_lcd_orientation_t;
+
 /**
  * \brief           GUI LCD structure
  */
 typedef struct {
-    gui_dim_t width;                        /*!< LCD width in units of pixels */
+    gui_dim_t width;                        /*!< LCD width in units of pixels.
+                                                Low-level sets panel native width, GUI swaps width and height for `90` and `270` degrees orientation */
     gui_dim_t height;                       /*!< LCD height in units of pixels */
+    gui_lcd_orientation_t orientation;      /*!< LCD orientation, set by low-level driver on initialization */
     uint8_t pixel_size;                     /*!< Number of bytes per pixel */
     gui_layer_t* active_layer;              /*!< Active layer number currently shown to LCD */
     gui_layer_t* drawing_layer;             /*!< Currently active drawing layer */
@@ -405,10 +419,39 @@ typedef struct {
 typedef struct {
     gui_dim_t x_size;                       /*!< Image X size */
     gui_dim_t y_size;                       /*!< Image Y size */
-    uint8_t bpp;                            /*!< Bits per pixel */
-    const uint8_t* image;                   /*!< Pointer to image byte array */
+    uint8_t bpp;                            /*!< Bits per pixel. Use `8` or `4` together with `clut` for palette-indexed image */
+    const uint8_t* image;                   /*!< Pointer to image byte array.
+                                                For `4` bits per pixel, first pixel is in upper nibble and each line starts at new byte */
+    const gui_color_t* clut;                /*!< Pointer to color look-up table in ARGB8888 format for indexed images, `NULL` otherwise.
+                                                When entries are changed in place, call \ref gui_draw_image_clutchanged */
+    uint16_t clut_size;                     /*!< Number of entries in `clut` table, max `256` for `8` and `16` for `4` bits per pixel */
 } gui_image_desc_t;
 
+/**
+ * \ingroup         GUI_IMAGECACHE
+ * \brief           Image decoder function used on image cache miss
+ * \param[in]       img: Source image to decode
+ * \param[in]       bpp: Bits per pixel of decoded image
+ * \param[out]      data: Memory to write decoded image to
+ * \param[in]       len: Size of `data` memory in units of bytes
+ * \return          `1` on success, `0` otherwise
+ */
+typedef uint8_t (*gui_imagecache_decode_fn)(const gui_image_desc_t* img, uint8_t bpp, uint8_t* data, size_t len);
+
+/**
+ * \ingroup         GUI_IMAGECACHE
+ * \brief           Image cache statistics
+ */
+typedef struct {
+    uint32_t hits;                          /*!< Number of requests found in cache */
+    uint32_t misses;                        /*!< Number of requests which required decoding */
+    uint32_t evictions;                     /*!< Number of entries removed to make room for new ones */
+    size_t entries;                         /*!< Number of currently cached entries */
+    size_t used;                            /*!< Number of bytes currently used by cache */
+    size_t used_max;                        /*!< Maximal number of bytes used by cache */
+    size_t budget;                          /*!< Maximal number of bytes cache may use */
+} gui_imagecache_stats_t;
+
 /**
  * \brief           Low-level LCD command enumeration
  */
@@ -447,6 +490,7 @@ typedef struct gui_ll_t {
     void            (*DrawImage16)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 16BPP (RGB565) images */
     void            (*DrawImage24)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 24BPP (RGB888) images */
     void            (*DrawImage32)  (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t);   /*!< Pointer to function for drawing 32BPP (ARGB8888) images */
+    void            (*DrawImageIndexed) (gui_lcd_t *, gui_layer_t *, const gui_image_desc_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t); /*!< Pointer to function for drawing palette-indexed (L8 or L4 with CLUT) images. Source line offset is in units of pixels */
     void            (*CopyChar)     (gui_lcd_t *, gui_layer_t *, void *, const void *, gui_dim_t, gui_dim_t, gui_dim_t, gui_dim_t, gui_color_t);                /*!< Pointer to copy char function with alpha only as source */
 } gui_ll_t;
 
@@ -468,6 +512,24 @@ typedef struct {
     const uint8_t* data;                    /*!< Pointer to actual data for font */
 } gui_font_char_t;
 
+/**
+ * \brief           Range of consecutive character codes available in font
+ */
+typedef struct {
+    uint32_t first;                         /*!< First character code in range */
+    uint32_t last;                          /*!< Last character code in range */
+    uint16_t index;                         /*!< Index of first range character in font character array */
+} gui_font_range_t;
+
+/**
+ * \brief           Kerning pair, adjusts space between two characters
+ */
+typedef struct {
+    uint16_t first;                         /*!< Index of left character in font character array */
+    uint16_t second;                        /*!< Index of right character in font character array */
+    int8_t value;                           /*!< Horizontal adjustment in units of pixels, negative value moves characters closer */
+} gui_font_kern_t;
+
 /**
  * \brief           FONT structure for writing usage
  */
@@ -478,9 +540,25 @@ typedef struct {
     uint16_t endchar;                       /*!< End character number in list */
     uint8_t flags;                          /*!< List of flags for font */
     const gui_font_char_t* data;            /*!< Pointer to first character */
+    const gui_font_range_t* ranges;         /*!< Pointer to ranges sorted by character code, for fonts with gaps between characters.
+                                                    Set to `NULL` when all characters from `startchar` to `endchar` are in list */
+    uint16_t ranges_count;                  /*!< Number of entries in ranges array */
+    const gui_font_kern_t* kerning;         /*!< Pointer to kerning pairs sorted by `first` and `second` character index.
+                                                    Set to `NULL` when font has no kerning */
+    const uint16_t* kerning_index;          /*!< Index of first kerning pair for each character in font character array.
+                                                    Array has one entry more than characters in font, last entry is number of pairs */
+    const uint8_t* advance;                 /*!< Pointer to \ref GUI_FONT_ADVANCE_COUNT advance widths of characters,
+                                                    starting with \ref GUI_FONT_ADVANCE_FIRST, without kerning.
+                                                    Set to `NULL` to build table in RAM when needed */
 } gui_font_t;
 
+#define GUI_FONT_ADVANCE_FIRST          ((uint32_t)0x20)    /*!< First character in font advance table */
+#define GUI_FONT_ADVANCE_COUNT          ((size_t)0x60)      /*!< Number of characters in font advance table */
+
 #define GUI_FLAG_FONT_AA                ((uint8_t)0x01) /*!< Indicates anti-alliasing on font */
+#define GUI_FLAG_FONT_AA4               ((uint8_t)0x20) /*!< Indicates anti-alliased font with 4 bits per pixel, used together with \ref GUI_FLAG_FONT_AA */
+#define GUI_FLAG_FONT_AA8               ((uint8_t)0x40) /*!< Indicates anti-alliased font with 8 bits per pixel, used together with \ref GUI_FLAG_FONT_AA */
+#define GUI_FLAG_FONT_RLE               ((uint8_t)0x10) /*!< Indicates run-length encoded character data. Check \ref gui_text_rle_getspan for format */
 #define GUI_FLAG_TEXT_RIGHTALIGN        ((uint8_t)0x02) /*!< Indicates right align text if string length is too wide for rectangle */
 #define GUI_FLAG_TEXT_MULTILINE         ((uint8_t)0x04) /*!< Indicates multi line support on widget */
 #define GUI_FLAG_TEXT_EDITMODE          ((uint8_t)0x08) /*!< Edit mode is enabled on text */
@@ -490,12 +568,128 @@ typedef struct {
  * \brief           Char temporary entry stored in RAM for faster copy with blending operations
  */
 typedef struct {
-    gui_linkedlist_t list;                  /*!< Linked list entry. Must always be first on the list */
+    gui_linkedlist_t list;                  /*!< Linked list entry, least recently used entry is first. Must always be first on the list */
     const gui_font_char_t* ch;              /*!< Character value */
     const gui_font_t* font;                 /*!< Pointer to font structure */
+    size_t size;                            /*!< Total entry size in units of bytes */
 } gui_font_charentry_t;
+
+/**
+ * \brief           Decoder state for run-length encoded character data
+ */
+typedef struct {
+    const uint8_t* data;                    /*!< Pointer to current data byte */
+    uint8_t bpp;                            /*!< Bits per pixel of coverage values */
+    uint8_t count;                          /*!< Number of pixels left in current packet */
+    uint8_t literal;                        /*!< Status indicating current packet is literal */
+    uint8_t value;                          /*!< Coverage value of current run packet */
+    uint8_t bit;                            /*!< Number of bits left in current literal data byte */
+} gui_font_rle_t;
+
+/**
+ * \brief           Characters of font packed to single alpha texture
+ */
+typedef struct {
+    const gui_font_t* font;                 /*!< Packed font, `NULL` when atlas is not used */
+    uint32_t* offsets;                      /*!< Offset of each character in texture, in order of font character array.
+                                                    Texture memory follows in the same allocation */
+    uint8_t* data;                          /*!< Texture with one byte of alpha per pixel */
+    size_t width;                           /*!< Texture width in units of pixels, also line length in units of bytes */
+    size_t height;                          /*!< Texture height in units of pixels */
+} gui_font_atlas_t;
 #endif /* defined(GUI_INTERNAL) || __DOXYGEN__ */
 
+/**
+ * \ingroup         GUI_TEXT
+ * \brief           Glyph cache statistics
+ */
+typedef struct {
+    uint32_t hits;                          /*!< Number of glyphs found in cache */
+    uint32_t misses;                        /*!< Number of glyphs which were not in cache */
+    uint32_t evictions;                     /*!< Number of glyphs removed to make room for new ones */
+    size_t entries;                         /*!< Number of currently cached glyphs */
+    size_t used;                            /*!< Number of bytes currently used by cache */
+    size_t used_max;                        /*!< Maximal number of bytes used by cache */
+    size_t budget;                          /*!< Maximal number of bytes cache may use */
+} gui_text_cachestats_t;
+
+/**
+ * \ingroup         GUI_ASSET
+ * \brief           Asset type
+ */
+typedef enum {
+    GUI_ASSET_TYPE_NONE = 0x00,             /*!< Asset is not loaded */
+    GUI_ASSET_TYPE_FONT,                    /*!< Asset is font, use \ref gui_asset_getfont */
+    GUI_ASSET_TYPE_IMAGE,                   /*!< Asset is image, use \ref gui_asset_getimage */
+} gui_asset_type_t;
+
+/**
+ * \ingroup         GUI_ASSET
+ * \brief           Block read function for assets which are not in addressable memory
+ * \param[in]       arg: User argument, passed to \ref gui_asset_loadread
+ * \param[in]       offset: Offset from start of asset in units of bytes
+ * \param[out]      data: Memory to read data to
+ * \param[in]       len: Number of bytes to read
+ * \return          `1` on success, `0` otherwise
+ */
+typedef uint8_t (*gui_asset_read_fn)(void* arg, uint32_t offset, void* data, size_t len);
+
+/**
+ * \ingroup         GUI_ASSET
+ * \brief           Loaded font or image asset
+ */
+typedef struct {
+    gui_asset_type_t type;                  /*!< Asset type */
+    gui_font_t font;                        /*!< Font structure, valid for \ref GUI_ASSET_TYPE_FONT */
+    gui_image_desc_t image;                 /*!< Image descriptor, valid for \ref GUI_ASSET_TYPE_IMAGE */
+    void* tables;                           /*!< Character and range tables allocated in GUI memory */
+    uint8_t* data;                          /*!< Asset data region copied to GUI memory, `NULL` when used in place */
+    void* map;                              /*!< Address of mapped asset file, `NULL` when not mapped by GUI */
+    size_t map_len;                         /*!< Length of mapped asset file in units of bytes */
+} gui_asset_t;
+
+/**
+ * \ingroup         GUI_TEXT
+ * \brief           Single line of cached text layout
+ */
+typedef struct {
+    size_t offset;                          /*!< Line start offset from string start in units of bytes */
+    size_t read;                            /*!< Number of characters to read for line */
+    size_t draw;                            /*!< Number of characters to draw, the rest are skipped white spaces */
+    gui_dim_t width;                        /*!< Line width in units of pixels */
+} gui_text_layout_line_t;
+
+/**
+ * \ingroup         GUI_TEXT
+ * \brief           Cached text layout, calculated by \ref gui_draw_writetext and reused until key changes
+ */
+typedef struct {
+    const gui_char* str;                    /*!< String pointer, part of key */
+    size_t len;                             /*!< String length in units of bytes, part of key */
+    uint32_t hash;                          /*!< String content hash, part of key */
+    const gui_font_t* font;                 /*!< Font, part of key */
+    gui_dim_t boxwidth;                     /*!< Drawing box width, part of key */
+    gui_dim_t lineheight;                   /*!< Line height, part of key */
+    uint8_t flags;                          /*!< Text flags, part of key */
+    uint8_t valid;                          /*!< Status indicating layout is calculated */
+
+    size_t start;                           /*!< Drawing start offset in units of bytes, used when right aligned text is too long */
+    gui_dim_t xoffset;                      /*!< Horizontal offset of right aligned text which is too long */
+    gui_dim_t height;                       /*!< Total text height in units of pixels */
+    gui_text_layout_line_t* lines;          /*!< Pointer to array of lines */
+    size_t count;                           /*!< Number of lines in array */
+    size_t size;                            /*!< Number of allocated lines */
+#if GUI_CFG_USE_TEXT_RUN || __DOXYGEN__
+    uint8_t* run;                           /*!< Pre-rendered `A8` alpha map of all lines, `NULL` when not rendered */
+    gui_dim_t run_x;                        /*!< Alpha map X position relative to text start X position */
+    gui_dim_t run_y;                        /*!< Alpha map Y position relative to text top Y position */
+    gui_dim_t run_width;                    /*!< Alpha map width and line stride in units of pixels */
+    gui_dim_t run_height;                   /*!< Alpha map height in units of pixels */
+    uint8_t run_align;                      /*!< Horizontal alignment used for alpha map */
+    uint8_t run_failed;                     /*!< Status indicating text cannot be pre-rendered with current layout */
+#endif /* GUI_CFG_USE_TEXT_RUN */
+} gui_text_layout_t;
+
 #if !__DOXYGEN__
 #define ________                        0x00
 #define _______X                        0x01
@@ -1129,6 +1323,27 @@ typedef struct {
 
 #if defined(GUI_INTERNAL) || __DOXYGEN__
 
+/**
+ * \ingroup         GUI_EFFECT
+ * \brief           Widget effects setup and cached data
+ */
+typedef struct gui_effect {
+    gui_dim_t shadow_x;                     /*!< Shadow X offset relative to widget */
+    gui_dim_t shadow_y;                     /*!< Shadow Y offset relative to widget */
+    gui_dim_t shadow_radius;                /*!< Shadow blur radius in units of pixels */
+    gui_color_t shadow_color;               /*!< Shadow color, alpha channel sets shadow opacity. Shadow is disabled when alpha is `0` */
+    uint8_t* shadow_prof;                   /*!< Cached horizontal and vertical shadow profile */
+    gui_dim_t shadow_width;                 /*!< Widget width for which profile is valid */
+    gui_dim_t shadow_height;                /*!< Widget height for which profile is valid */
+
+    gui_dim_t blur_radius;                  /*!< Backdrop blur radius in units of pixels, `0` when blur is disabled */
+    gui_color_t blur_tint;                  /*!< Tint color blended over blurred backdrop */
+    uint8_t* blur_data;                     /*!< Cached downscaled and blurred backdrop in RGB888 format */
+    gui_dim_t blur_width;                   /*!< Visible widget width for which backdrop is valid */
+    gui_dim_t blur_height;                  /*!< Visible widget height for which backdrop is valid */
+    uint8_t blur_scale;                     /*!< Downscale factor of cached backdrop */
+} gui_effect_t;
+
 /**
  * \brief           Common GUI values for widgets
  */
@@ -1173,8 +1388,17 @@ typedef struct gui_handle {
     gui_char* text;                         /*!< Pointer to widget text if exists */
     size_t textmemsize;                     /*!< Number of bytes for text when dynamically allocated */
     size_t textcursor;                      /*!< Text cursor position */
+#if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
+    size_t textid;                          /*!< Translation ID of text when \ref GUI_FLAG_TEXTID is set */
+#endif /* GUI_CFG_USE_TRANSLATE */
     gui_timer_t* timer;                     /*!< Software timer pointer */
     gui_color_t* colors;                    /*!< Pointer to allocated color memory when custom colors are used */
+#if GUI_CFG_USE_EFFECTS || __DOXYGEN__
+    gui_effect_t* effect;                   /*!< Pointer to allocated effects when shadow or backdrop blur is used */
+#endif /* GUI_CFG_USE_EFFECTS */
+#if GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__
+    gui_text_layout_t* layout;              /*!< Pointer to allocated text layout cache */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
     
     /* Scroll feature, available only for widgets with children support */
     gui_dim_t x_scroll;                     /*!< Scroll of widgets in horizontal direction in units of pixels */
@@ -1210,6 +1434,10 @@ typedef struct {
 typedef struct gui_translate {
     const gui_translate_language_t* source; /*!< Pointer to source language table */
     const gui_translate_language_t* active; /*!< Pointer to current language table */
+#if GUI_CFG_USE_TRANSLATE_INDEX || __DOXYGEN__
+    uint16_t* index;                        /*!< Hash index of source entries, value is entry index + 1, `0` for empty slot */
+    size_t index_mask;                      /*!< Number of index slots minus `1` */
+#endif /* GUI_CFG_USE_TRANSLATE_INDEX */
 } gui_translate_t;
 
 /**
@@ -155,11 +155,14 @@ typedef struct {
     gui_color_t color1;                     /*!< Color 1 */
     gui_color_t color2;                     /*!< Color 2 */
     uint32_t scrolly;                       /*!< Scroll in vertical direction */
+#if GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__
+    gui_text_layout_t* layout;              /*!< Optional text layout cache. Set to `NULL` to measure text on every draw */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
 } gui_draw_text_t;
 
-#define GUI_FLAG_DRAW_GRAD_VER              0x01
-#define GUI_FLAG_DRAW_GRAD_HOR              0x02
-#define GUI_FLAG_DRAW_FILLED                0x04
+#define GUI_FLAG_DRAW_GRAD_VER              0x01    /*!< Vertical gradient, from top to bottom */
+#define GUI_FLAG_DRAW_GRAD_HOR              0x02    /*!< Horizontal gradient, from left to right */
+#define GUI_FLAG_DRAW_FILLED                0x04    /*!< Filled shape */
 
 /**
  * \brief           Extended rectangle structure
@@ -215,6 +218,19 @@ typedef struct {
     gui_dim_t y;                           /*!< Poly point Y location */
 } gui_draw_poly_t;
 
+#define GUI_FLAG_DRAW_IMAGE_BILINEAR        0x01    /*!< Use bilinear filter instead of nearest neighbour when transforming image */
+
+/**
+ * \brief           Image transformation parameters
+ * \sa              gui_draw_image_ex
+ */
+typedef struct {
+    float scale_x;                          /*!< Scale factor in X direction, `1.0` for original size */
+    float scale_y;                          /*!< Scale factor in Y direction, `1.0` for original size */
+    float angle;                            /*!< Clockwise rotation angle around image center in units of degrees */
+    uint8_t flags;                          /*!< Transformation flags, \ref GUI_FLAG_DRAW_IMAGE_BILINEAR */
+} gui_draw_image_transform_t;
+
 void        gui_draw_text_init(gui_draw_text_t* f);
 void        gui_draw_fillscreen(const gui_display_t* disp, gui_color_t color);
 void        gui_draw_setpixel(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_color_t color);
@@ -224,6 +240,11 @@ void        gui_draw_hline(const gui_display_t* disp, gui_dim_t x, gui_dim_t y,
 void        gui_draw_line(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_color_t color);
 void        gui_draw_rectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color);
 void        gui_draw_rectangle_ex(const gui_display_t* disp, gui_draw_rect_ex_t* rect);
+void        gui_draw_gradientrect(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, uint8_t flags);
+void        gui_draw_lineargradient(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, float angle);
+void        gui_draw_radialgradient(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_gradient_t* grad, gui_dim_t cx, gui_dim_t cy, gui_dim_t r);
+void        gui_draw_patternrect(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const gui_image_desc_t* img);
+void        gui_draw_alphamask(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, const uint8_t* mask, gui_color_t color);
 void        gui_draw_filledrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_color_t color);
 void        gui_draw_roundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color);
 void        gui_draw_filledroundedrectangle(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_dim_t r, gui_color_t color);
@@ -234,6 +255,10 @@ void        gui_draw_filledcirclecorner(const gui_display_t* disp, gui_dim_t x0,
 void        gui_draw_triangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1,  gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_filledtriangle(const gui_display_t* disp, gui_dim_t x1, gui_dim_t y1, gui_dim_t x2, gui_dim_t y2, gui_dim_t x3, gui_dim_t y3, gui_color_t color);
 void        gui_draw_image(gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img);
+void        gui_draw_image_ex(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, const gui_image_desc_t* img, const gui_draw_image_transform_t* tr);
+void        gui_draw_image_transformsize(const gui_image_desc_t* img, const gui_draw_image_transform_t* tr, gui_dim_t* width, gui_dim_t* height);
+void        gui_draw_image_transform(const gui_image_desc_t* img, const gui_draw_image_transform_t* tr, gui_image_desc_t* out, uint8_t* data);
+void        gui_draw_image_clutchanged(const gui_color_t* clut);
 void        gui_draw_writetext(const gui_display_t* disp, const gui_font_t* font, const gui_char* str, gui_draw_text_t* draw);
 void        gui_draw_rectangle3d(const gui_display_t* disp, gui_dim_t x, gui_dim_t y, gui_dim_t width, gui_dim_t height, gui_draw_3d_state_t state);
 void        gui_draw_poly(const gui_display_t* disp, const gui_draw_poly_t* points, size_t len, gui_color_t color);
@@ -0,0 +1,83 @@
+/**	
+ * \file            gui_effect.h
+ * \brief           Widget shadow and backdrop blur effects
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_EFFECT_H
+#define GUI_HDR_EFFECT_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_EFFECT Widget effects
+ * \brief           Drop shadow and backdrop blur effects for widgets
+ *
+ * Drop shadow is drawn around widget before widget itself,
+ * backdrop blur replaces content under widget with its blurred copy.
+ * For blur to be visible, widget must not fill its background, for example
+ * by setting background color to \ref GUI_COLOR_TRANS.
+ *
+ * Both effects are calculated once and kept in GUI memory.
+ * Blur is recalculated only when content under widget is redrawn,
+ * while redraw of widget alone reuses cached backdrop.
+ *
+ * \{
+ */
+
+uint8_t     gui_effect_setshadow(gui_handle_p h, gui_dim_t x, gui_dim_t y, gui_dim_t radius, gui_color_t color);
+uint8_t     gui_effect_setbackdropblur(gui_handle_p h, gui_dim_t radius, gui_color_t tint);
+uint8_t     gui_effect_clear(gui_handle_p h);
+void        gui_effect_boxblur(uint8_t* data, gui_dim_t width, gui_dim_t height, uint8_t channels, gui_dim_t radius);
+
+#if defined(GUI_INTERNAL) && !__DOXYGEN__
+//Strictly private functions by GUI
+void    guii_effect_getarea(gui_handle_p h, gui_dim_t* x1, gui_dim_t* y1, gui_dim_t* x2, gui_dim_t* y2);
+uint8_t guii_effect_hasbackdrop(gui_handle_p h);
+void    guii_effect_draw(gui_handle_p h, uint8_t fresh);
+void    guii_effect_free(gui_handle_p h);
+#endif /* !__DOXYGEN__ */
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_EFFECT_H */
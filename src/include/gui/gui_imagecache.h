@@ -0,0 +1,67 @@
+/**	
+ * \file            gui_imagecache.h
+ * \brief           Decoded image cache
+ */
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+#ifndef GUI_HDR_IMAGECACHE_H
+#define GUI_HDR_IMAGECACHE_H
+
+/* C++ detection */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "gui_utils.h"
+
+/**
+ * \ingroup         GUI_UTILS
+ * \defgroup        GUI_IMAGECACHE Image cache
+ * \brief           Cache of decoded images in GUI memory
+ * \{
+ */
+
+const gui_image_desc_t* gui_imagecache_get(const gui_image_desc_t* img, uint8_t bpp, gui_imagecache_decode_fn decode_fn);
+uint8_t         gui_imagecache_pin(const gui_image_desc_t* img, uint8_t pin);
+void            gui_imagecache_remove(const gui_image_desc_t* img);
+void            gui_imagecache_setbudget(size_t size);
+void            gui_imagecache_getstats(gui_imagecache_stats_t* s);
+void            gui_imagecache_resetstats(void);
+
+/**
+ * \}
+ */
+
+/* C++ detection */
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GUI_HDR_IMAGECACHE_H */
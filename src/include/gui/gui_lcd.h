@@ -50,6 +50,8 @@ extern "C" {
 
 gui_dim_t  gui_lcd_getwidth(void);
 gui_dim_t  gui_lcd_getheight(void);
+gui_lcd_orientation_t gui_lcd_getorientation(void);
+void        gui_lcd_rotatearea(const gui_layer_t* layer, const gui_display_t* area, void* dst);
 void        gui_lcd_confirmactivelayer(uint8_t layer_num);
 
 /**
@@ -52,6 +52,7 @@ extern "C" {
     
 uint8_t gui_math_sqrt(float x, float* const result);
 uint8_t gui_math_rsqrt(float x, float* const result);
+uint8_t gui_math_isqrt(uint32_t x, uint32_t* const result);
 uint8_t gui_math_distancebetweenxy(float x1, float y1, float x2, float y2, float* const result);
 uint8_t gui_math_centerofxy(float x1, float y1, float x2, float y2, float* const resultx, float* const resulty);
     
@@ -61,6 +61,55 @@ typedef struct mem_region_t {
  */
 typedef mem_region_t gui_mem_region_t;
 
+/**
+ * \brief           Number of size classes in histogram of free blocks
+ */
+#define GUI_MEM_STAT_HIST_SIZE          8
+
+/**
+ * \brief           Heap statistics
+ */
+typedef struct {
+    size_t total;                       /*!< Total heap size in units of bytes */
+    size_t free;                        /*!< Free bytes, including metadata of free blocks */
+    size_t min_free;                    /*!< Minimal free bytes ever */
+    size_t free_blocks;                 /*!< Number of free blocks */
+    size_t free_sum;                    /*!< Sum of user sizes of all free blocks */
+    size_t largest_free;                /*!< User size of largest free block */
+    uint16_t fragmentation;             /*!< Fragmentation index in units of 1/1000 */
+    size_t hist[GUI_MEM_STAT_HIST_SIZE];/*!< Number of free blocks per size class.
+                                                First class has blocks below `32` bytes, each next doubles the limit,
+                                                last class has all blocks of `2048` bytes or more */
+} gui_mem_stat_t;
+
+/**
+ * \brief           Built-in allocation tags
+ */
+typedef enum {
+    GUI_MEM_TAG_OTHER = 0x00,           /*!< Blocks without tag */
+    GUI_MEM_TAG_WIDGET,                 /*!< Widget data and widget handles without widget type tag */
+    GUI_MEM_TAG_TEXT,                   /*!< Widget texts, text layouts and translation index */
+    GUI_MEM_TAG_GLYPH,                  /*!< Glyph cache entries and font atlases */
+    GUI_MEM_TAG_IMAGE,                  /*!< Image caches */
+    GUI_MEM_TAG_LAYER,                  /*!< Drawing layers */
+    GUI_MEM_TAG_EFFECT,                 /*!< Cached data of widget effects */
+    GUI_MEM_TAG_LIST,                   /*!< Items of list widgets */
+    GUI_MEM_TAG_TIMER,                  /*!< Software timers */
+    GUI_MEM_TAG_POOL,                   /*!< Slabs of block pools and objects allocated through pools */
+    GUI_MEM_TAG_FRAME,                  /*!< Frame arena allocations, which did not fit into arena */
+    GUI_MEM_TAG_USER,                   /*!< First tag available to \ref gui_mem_tag_register */
+} gui_mem_tag_t;
+
+/**
+ * \brief           Live allocations of single tag
+ */
+typedef struct {
+    const char* name;                   /*!< Tag name */
+    size_t bytes;                       /*!< Live bytes, including block metadata */
+    size_t count;                       /*!< Number of live blocks */
+    size_t max_bytes;                   /*!< Maximal number of live bytes ever */
+} gui_mem_tag_info_t;
+
 void* gui_mem_alloc(uint32_t size);
 void* gui_mem_realloc(void* ptr, size_t size);
 void* gui_mem_calloc(size_t num, size_t size);
@@ -70,6 +119,43 @@ size_t gui_mem_getfull(void);
 size_t gui_mem_getminfree(void);
 
 uint8_t gui_mem_assignmemory(const gui_mem_region_t* regions, size_t size);
+uint8_t gui_mem_getstat(gui_mem_stat_t* stat);
+
+void gui_mem_settag(void* ptr, uint8_t tag);
+uint8_t gui_mem_tag_register(const char* name);
+uint8_t gui_mem_tag_getinfo(uint8_t tag, gui_mem_tag_info_t* info);
+
+/**
+ * \brief           Usage of fixed size block pool
+ */
+typedef struct {
+    size_t block_size;                  /*!< Aligned size of single block in units of bytes */
+    size_t slabs;                       /*!< Number of slabs allocated from main heap */
+    size_t capacity;                    /*!< Number of blocks in all slabs */
+    size_t used;                        /*!< Number of currently used blocks */
+    size_t max_used;                    /*!< Maximal number of used blocks ever */
+    size_t mem_size;                    /*!< Memory taken from main heap in units of bytes */
+} gui_mem_pool_info_t;
+
+/**
+ * \brief           Usage of frame arena
+ */
+typedef struct {
+    size_t size;                        /*!< Arena size in units of bytes */
+    size_t used;                        /*!< Currently used bytes, including headers */
+    size_t max_used;                    /*!< Maximal used bytes ever, including requests that did not fit */
+    size_t overflows;                   /*!< Number of allocations made from main heap */
+} gui_mem_frame_info_t;
+
+void* gui_mem_pool_alloc(size_t size);
+void* gui_mem_pool_calloc(size_t size);
+void gui_mem_pool_free(void* ptr);
+uint8_t gui_mem_pool_getinfo(size_t index, gui_mem_pool_info_t* info);
+
+void* gui_mem_frame_alloc(size_t size);
+void gui_mem_frame_free(void* ptr);
+void gui_mem_frame_reset(void);
+uint8_t gui_mem_frame_getinfo(gui_mem_frame_info_t* info);
     
 /**
  * \}
@@ -93,8 +93,6 @@ typedef struct {
     gui_linkedlistroot_t root;              /*!< Root linked list of widgets */
     gui_timer_core_t timers;                /*!< Software structure management */
     
-    gui_linkedlistroot_t root_fonts;        /*!< Root linked list of font widgets */
-    
     gui_evt_param_t evt_param;
     gui_evt_result_t evt_result;
     
@@ -87,6 +87,7 @@ typedef struct {
     const gui_char* str;                /*!< Pointer to source string */
 #if GUI_CFG_USE_UNICODE || __DOXYGEN__
     gui_string_unicode_t s;             /*!< Unicode processing structure */
+    const gui_char* end;                /*!< Pointer to string termination, `NULL` until first needed */
 #endif /* GUI_CFG_USE_UNICODE || __DOXYGEN__ */
 } gui_string_t;
 
@@ -98,6 +99,7 @@ int gui_string_compare(const gui_char* const s1, const gui_char* const s2);
 uint8_t gui_string_isprintable(uint32_t ch);
 uint8_t gui_string_prepare(gui_string_t* const s, const gui_char* const str);
 uint8_t gui_string_getch(gui_string_t* const str, uint32_t* const out, uint8_t* const len);
+size_t gui_string_getchs(gui_string_t* const s, uint32_t* out, size_t count);
 uint8_t gui_string_getchreverse(gui_string_t* const str, uint32_t* const out, uint8_t* const len);
 uint8_t gui_string_gotoend(gui_string_t* const str);
     
@@ -50,8 +50,25 @@ extern "C" {
 
 const gui_font_char_t *     gui_text_getchardesc(const gui_font_t* font, uint32_t ch);
 void                        gui_text_getcharsize(const gui_font_t* font, uint32_t ch, gui_dim_t* width, gui_dim_t* height);
+gui_dim_t                   gui_text_getadvance(const gui_font_t* font, uint32_t ch);
+size_t                      gui_text_getwidths(const gui_font_t* font, const gui_char* str, gui_dim_t* widths, size_t count);
+size_t                      gui_text_getfitcount(const gui_dim_t* widths, size_t count, gui_dim_t width);
+gui_dim_t                   gui_text_getkerning(const gui_font_t* font, const gui_font_char_t* left, const gui_font_char_t* right);
 gui_font_charentry_t *      gui_text_getcharentry(const gui_font_t* font, const gui_font_char_t* c);
 gui_font_charentry_t *      gui_text_createcharentry(const gui_font_t* font, const gui_font_char_t* c);
+uint8_t                     gui_text_getfontbpp(const gui_font_t* font);
+void                        gui_text_rle_init(gui_font_rle_t* rle, const gui_font_t* font, const gui_font_char_t* c);
+void                        gui_text_rle_getspan(gui_font_rle_t* rle, uint8_t* alpha, uint8_t* len, uint8_t max);
+void                        gui_text_getcharrow(const gui_font_t* font, const gui_font_char_t* c, gui_font_rle_t* rle, uint8_t y, uint8_t* row);
+void                        gui_text_getcharalpha(const gui_font_t* font, const gui_font_char_t* c, uint8_t* dst, size_t stride);
+void                        gui_text_combinealpha(uint8_t* dst, size_t dst_stride, const uint8_t* src, size_t src_stride, gui_dim_t width, gui_dim_t height);
+const uint8_t *             gui_text_getcharmap(const gui_font_t* font, const gui_font_char_t* c, size_t* stride);
+uint8_t                     gui_text_createatlas(const gui_font_t* font, size_t width);
+void                        gui_text_removeatlas(const gui_font_t* font);
+void                        gui_text_removecache(const gui_font_t* font);
+void                        gui_text_setcachebudget(size_t size);
+void                        gui_text_getcachestats(gui_text_cachestats_t* s);
+void                        gui_text_resetcachestats(void);
 
 /**
  * \}
@@ -49,6 +49,7 @@ extern "C" {
  */
  
 const gui_char* gui_translate_get(const gui_char* const src);
+const gui_char* gui_translate_getid(size_t id);
 uint8_t         gui_translate_setactivelanguage(const gui_translate_language_t* const lang);
 uint8_t         gui_translate_setsourcelanguage(const gui_translate_language_t* const lang); 
     
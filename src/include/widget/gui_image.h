@@ -50,6 +50,8 @@ extern "C" {
     
 gui_handle_p    gui_image_create(gui_id_t id, float x, float y, float width, float height, gui_handle_p parent, gui_widget_evt_fn evt_fn, uint16_t flags);
 uint8_t         gui_image_setsource(gui_handle_p h, const gui_image_desc_t* img);
+uint8_t         gui_image_settransform(gui_handle_p h, const gui_draw_image_transform_t* tr, uint8_t cached);
+uint8_t         gui_image_setdecoder(gui_handle_p h, gui_imagecache_decode_fn decode_fn, uint8_t bpp);
 
 /**
  * \}
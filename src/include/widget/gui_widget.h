@@ -336,6 +336,9 @@ uint8_t         guii_widget_setparam(gui_handle_p h, uint16_t cfg, const void* d
 uint8_t         guii_widget_getparam(gui_handle_p h, uint16_t cfg, void* data);
 gui_dim_t       guii_widget_getparentabsolutex(gui_handle_p h);
 gui_dim_t       guii_widget_getparentabsolutey(gui_handle_p h);
+#if GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__
+gui_text_layout_t*  guii_widget_gettextlayout(gui_handle_p h);
+#endif /* GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__ */
 
 /**
  * \}
@@ -364,6 +367,9 @@ uint8_t         gui_widget_setstyle(gui_handle_p h, const gui_style_p style);
 uint32_t            gui_widget_alloctextmemory(gui_handle_p h, uint32_t size);
 uint8_t             gui_widget_freetextmemory(gui_handle_p h);
 uint8_t             gui_widget_settext(gui_handle_p h, const gui_char* text);
+#if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
+uint8_t             gui_widget_settextid(gui_handle_p h, size_t id);
+#endif /* GUI_CFG_USE_TRANSLATE || __DOXYGEN__ */
 const gui_char *    gui_widget_gettext(gui_handle_p h);
 const gui_char *    gui_widget_gettextcopy(gui_handle_p h, gui_char* dst, uint32_t len);
 uint8_t             gui_widget_setfont(gui_handle_p h, const gui_font_t* font);
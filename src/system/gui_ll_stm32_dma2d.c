@@ -237,6 +237,42 @@ void LCD_DrawImage32(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t*
     DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
 }
 
+static
+void LCD_DrawImageIndexed(gui_lcd_t* LCD, gui_layer_t* layer, const gui_image_desc_t* img, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc) {
+    static const gui_color_t* clut;                 /* Currently loaded CLUT in DMA2D memory */
+    static uint16_t clut_size;
+    uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
+    uint32_t InputFormat = img->bpp == 4 ? DMA2D_INPUT_L4 : DMA2D_INPUT_L8;
+    
+    if (!xSize || !ySize || !img->clut_size) {
+        return;
+    }
+    while (DMA2D->CR & DMA2D_CR_START);             /* Wait finished */
+    
+    /* Load CLUT only when changed, colors are in ARGB8888 format */
+    if (clut != img->clut || clut_size != img->clut_size) {
+        DMA2D->FGCMAR = (uint32_t)img->clut;        /* Set CLUT memory address */
+        DMA2D->FGPFCCR = InputFormat | ((uint32_t)(img->clut_size - 1) << DMA2D_FGPFCCR_CS_Pos);
+        DMA2D->FGPFCCR |= DMA2D_FGPFCCR_START;      /* Start CLUT loading */
+        while (DMA2D->FGPFCCR & DMA2D_FGPFCCR_START);   /* Wait CLUT loaded */
+        clut = img->clut;
+        clut_size = img->clut_size;
+    }
+    
+    DMA2D->FGMAR = (uint32_t)src;
+    DMA2D->BGMAR = (uint32_t)dst;                       
+    DMA2D->OMAR = (uint32_t)dst;
+    DMA2D->FGOR = offLineSrc;
+    DMA2D->BGOR = offLineDst;
+    DMA2D->OOR = offLineDst;
+    DMA2D->FGPFCCR = InputFormat | ((uint32_t)(img->clut_size - 1) << DMA2D_FGPFCCR_CS_Pos);    /* Foreground PFC Control Register */
+    DMA2D->BGPFCCR = PixelFormat;                   /* Background PFC Control Register (Defines the BG pixel format) */
+    DMA2D->OPFCCR  = PixelFormat;                   /* Output     PFC Control Register (Defines the output pixel format) */
+    DMA2D->NLR = (uint32_t)(xSize << 16) | (uint16_t)ySize;
+    
+    DMA2D_START(DMA2D_M2M_BLEND);                   /* Start DMA2D transfer */
+}
+
 static
 void LCD_CopyChar(gui_lcd_t* LCD, gui_layer_t* layer, void* dst, const void* src, gui_dim_t xSize, gui_dim_t ySize, gui_dim_t offLineDst, gui_dim_t offLineSrc, gui_color_t color) {
     uint32_t PixelFormat = GetPixelFormat(layer);   /* Get pixel format of specific layer */
@@ -286,6 +322,57 @@ void LCD_SetPixel(gui_lcd_t* LCD, gui_layer_t* layer, gui_dim_t x, gui_dim_t y,
     LCD_DrawHLine(LCD, layer, x, y, 1, color);
 }
 
+#if defined(LCD_ORIENTATION)
+
+/*
+ * Copy area of GUI layer to panel frame buffer with rotation.
+ * For 90 and 270 degrees, every line or column of area is single DMA2D transfer,
+ * where one pixel wide lines with line offsets make transposition
+ */
+static
+void LCD_RotateArea(gui_lcd_t* LCD, gui_layer_t* layer, const gui_display_t* area, void* dst) {
+    uint32_t PixelFormat = GetPixelFormat(layer);
+    gui_dim_t x1, y1, x2, y2, i, w = LCD->width, h = LCD->height;
+    
+    x1 = GUI_MAX(area->x1, 0);
+    y1 = GUI_MAX(area->y1, 0);
+    x2 = GUI_MIN(area->x2, w);
+    y2 = GUI_MIN(area->y2, h);
+    if (x1 >= x2 || y1 >= y2) {
+        return;
+    }
+    if (LCD->orientation != GUI_LCD_ORIENTATION_90 && LCD->orientation != GUI_LCD_ORIENTATION_270) {
+        while (DMA2D->CR & DMA2D_CR_START);         /* Wait finished */
+        gui_lcd_rotatearea(layer, area, dst);       /* DMA2D cannot mirror, use tiled copy */
+        return;
+    }
+    
+    for (i = 0; i < (LCD->orientation == GUI_LCD_ORIENTATION_90 ? y2 - y1 : x2 - x1); i++) {
+        while (DMA2D->CR & DMA2D_CR_START);         /* Wait finished */
+        if (LCD->orientation == GUI_LCD_ORIENTATION_90) {
+            /* Layer line y is panel column h - 1 - y */
+            DMA2D->FGMAR = (uint32_t)layer->start_address + LCD->pixel_size * (layer->width * (y1 + i) + x1);
+            DMA2D->OMAR = (uint32_t)dst + LCD->pixel_size * (h * x1 + (h - 1 - (y1 + i)));
+            DMA2D->FGOR = 0;
+            DMA2D->OOR = h - 1;
+            DMA2D->NLR = (uint32_t)(1 << 16) | (uint16_t)(x2 - x1);
+        } else {
+            /* Layer column x is panel line w - 1 - x */
+            DMA2D->FGMAR = (uint32_t)layer->start_address + LCD->pixel_size * (layer->width * y1 + (x1 + i));
+            DMA2D->OMAR = (uint32_t)dst + LCD->pixel_size * (h * (w - 1 - (x1 + i)) + y1);
+            DMA2D->FGOR = layer->width - 1;
+            DMA2D->OOR = 0;
+            DMA2D->NLR = (uint32_t)(1 << 16) | (uint16_t)(y2 - y1);
+        }
+        DMA2D->FGPFCCR = PixelFormat;
+        DMA2D->OPFCCR = PixelFormat;
+        
+        DMA2D_START(DMA2D_M2M);                     /* Start DMA2D transfer */
+    }
+}
+
+#endif /* defined(LCD_ORIENTATION) */
+
 /* Process DMA2D interrupt */
 void DMA2D_IRQHandler(void) {
     HAL_DMA2D_IRQHandler(&DMA2DHandle);
@@ -329,6 +416,9 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             LCD->width = LCD_WIDTH;
             LCD->height = LCD_HEIGHT;
             LCD->pixel_size = LCD_PIXEL_SIZE;
+#if defined(LCD_ORIENTATION)
+            LCD->orientation = LCD_ORIENTATION; /* GUI swaps width and height for 90 and 270 degrees */
+#endif /* defined(LCD_ORIENTATION) */
             
             /*******************************/
             /* Set layers count            */
@@ -337,7 +427,12 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             LCD->layers = Layers;
             for (i = 0; i < GUI_LAYERS; i++) {  /* Set each layer */
                 Layers[i].num = i;
+#if defined(LCD_ORIENTATION)
+                /* GUI draws to separate buffers, panel buffers are updated with rotation */
+                Layers[i].start_address = (void *)(LCD_FRAME_BUFFER + ((GUI_LAYERS + i) * LCD_FRAME_BUFFER_SIZE));
+#else /* defined(LCD_ORIENTATION) */
                 Layers[i].start_address = (void *)(LCD_FRAME_BUFFER + (i * LCD_FRAME_BUFFER_SIZE));
+#endif /* !defined(LCD_ORIENTATION) */
             }
             
             /*******************************/
@@ -357,6 +452,7 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             LL->DrawImage16 = LCD_DrawImage16;  /* Set draw function for 24bit image (RGB565) format */
             LL->DrawImage24 = LCD_DrawImage24;  /* Set draw function for 24bit image (RGB888) format */
             LL->DrawImage32 = LCD_DrawImage32;  /* Set draw function for 32bit image (ARGB8888/ABGR8888) format */
+            LL->DrawImageIndexed = LCD_DrawImageIndexed;    /* Set draw function for L8/L4 images with CLUT */
             LL->CopyChar = LCD_CopyChar;        /* Set draw function for char copy with alpha information */
             
             if (result) {
@@ -369,7 +465,15 @@ uint8_t gui_ll_control(gui_lcd_t* LCD, GUI_LL_Command_t cmd, void* param, void*
             return 1;                           /* Command processed */
         }
         case GUI_LL_Command_SetActiveLayer: {   /* Set new active layer */
-            gui_layer_t* layer = (gui_layer_t *)param;/* Read layer as byte */
+            gui_layer_t* layer = *(gui_layer_t **)param;    /* Read new active layer */
+#if defined(LCD_ORIENTATION)
+            void* panel = (void *)(LCD_FRAME_BUFFER + (layer->num * LCD_FRAME_BUFFER_SIZE));
+            
+            /* Panel buffer is behind by changes of previous frame too, update both areas */
+            LCD_RotateArea(LCD, layer, &LCD->active_layer->display, panel);
+            LCD_RotateArea(LCD, layer, &layer->display, panel);
+            while (DMA2D->CR & DMA2D_CR_START);     /* Wait finished before layer is shown */
+#endif /* defined(LCD_ORIENTATION) */
             layer->pending = 1;                 /* Set layer as pending and redraw on next reload */
 
             if (result) {
@@ -333,6 +333,7 @@ gui_debugbox_addstring(gui_handle_p h, const gui_char* text) {
 
     item = GUI_MEMALLOC(GUI_MEM_ALIGN(sizeof(*item)) + sizeof(*text) * (gui_string_lengthtotal(text) + 1));
     if (item != NULL) {
+        GUI_MEMTAG(item, GUI_MEM_TAG_LIST);
         item->text = (void *)((char *)item + GUI_MEM_ALIGN(sizeof(*item)));
         gui_string_copy(item->text, text);
         gui_widget_list_add_item(h, &o->ld, item);
@@ -256,7 +256,7 @@ delete_item(gui_handle_p h, int16_t index) {
  */
 static uint8_t
 remove_item_memory(gui_handle_p h, void* item) {
-    GUI_MEMFREE(item);
+    GUI_MEMPOOLFREE(item);
     return 1;
 }
 
@@ -537,8 +537,9 @@ gui_dropdown_addstring(gui_handle_p h, const gui_char* text) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
-    item = GUI_MEMALLOC(sizeof(*item));             /* Allocate memory for entry */
+    item = GUI_MEMPOOLALLOC(sizeof(*item));         /* Allocate memory for entry */
     if (item != NULL) {
+        GUI_MEMPOOLTAG(item, GUI_MEM_TAG_LIST);
         item->text = (gui_char *)text;
         gui_widget_list_add_item(h, &o->ld, item);  /* Add to linkedlist */
         
@@ -169,6 +169,9 @@ gui_edittext_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                     f.flags |= GUI_FLAG_TEXT_MULTILINE; /* Set multiline flag for widget */
                 }
                 
+#if GUI_CFG_USE_TEXT_LAYOUT
+                f.layout = guii_widget_gettextlayout(h);  /* Reuse line breaks until text changes */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             return 1;
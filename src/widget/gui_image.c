@@ -35,6 +35,9 @@
 #include "gui/gui_private.h"
 #include "widget/gui_image.h"
 
+#define GUI_FLAG_IMAGE_TRANSFORM            0x01    /*!< Image is drawn with transformation */
+#define GUI_FLAG_IMAGE_CACHED               0x02    /*!< Transformed image is cached in memory */
+
 /**
  * \ingroup         GUI_IMAGE
  * \brief           Image object structure
@@ -43,10 +46,85 @@ typedef struct {
     gui_handle C;                                   /*!< GUI handle object, must always be first on list */
     
     const gui_image_desc_t* image;                  /*!< Pointer to image object to draw */
+    gui_draw_image_transform_t tr;                  /*!< Image transformation parameters */
+    gui_image_desc_t* cache;                        /*!< Transformed image, allocated when cached mode is used */
+    uint8_t flags;                                  /*!< List of widget flags */
+#if GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__
+    gui_imagecache_decode_fn decode_fn;             /*!< Image decoder function, when image is not drawn directly */
+    uint8_t decode_bpp;                             /*!< Bits per pixel of decoded image */
+    const gui_image_desc_t* decoded;                /*!< Decoded image pinned in image cache */
+#endif /* GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__ */
 } gui_image_t;
 
 static uint8_t gui_image_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const param, gui_evt_result_t* const result);
 
+/**
+ * \brief           Release pinned decoded image
+ * \param[in]       o: Image widget object
+ */
+static void
+image_unpin(gui_image_t* o) {
+#if GUI_CFG_USE_IMAGE_CACHE
+    if (o->decoded != NULL) {
+        gui_imagecache_pin(o->decoded, 0);
+        o->decoded = NULL;
+    }
+#else
+    GUI_UNUSED(o);
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+}
+
+/**
+ * \brief           Get image to draw, decoded through image cache if decoder is set
+ * \param[in]       o: Image widget object
+ * \return          Pointer to image or `NULL` on failure
+ */
+static const gui_image_desc_t*
+image_get_source(gui_image_t* o) {
+#if GUI_CFG_USE_IMAGE_CACHE
+    const gui_image_desc_t* img;
+
+    if (o->decode_fn != NULL) {
+        img = gui_imagecache_get(o->image, o->decode_bpp, o->decode_fn);
+        if (img != o->decoded) {                    /* Image decoded again after it was removed from cache */
+            image_unpin(o);
+            if (img != NULL && gui_imagecache_pin(img, 1)) {    /* Keep image in cache while widget uses it */
+                o->decoded = img;
+            }
+        }
+        return img;
+    }
+#endif /* GUI_CFG_USE_IMAGE_CACHE */
+    return o->image;
+}
+
+/**
+ * \brief           Prepare transformed image in cache memory
+ * \param[in]       o: Image widget object
+ * \return          Pointer to cached image or `NULL` on failure
+ */
+static const gui_image_desc_t*
+image_get_cache(gui_image_t* o) {
+    const gui_image_desc_t* img;
+    gui_dim_t width, height;
+
+    if (o->cache == NULL) {
+        img = image_get_source(o);
+        if (img == NULL) {
+            return NULL;
+        }
+        gui_draw_image_transformsize(img, &o->tr, &width, &height);
+
+        /* Descriptor and image data are in single memory block */
+        o->cache = GUI_MEMALLOC(GUI_MEM_ALIGN(sizeof(*o->cache)) + (size_t)width * (size_t)height * 4);
+        if (o->cache != NULL) {
+            GUI_MEMTAG(o->cache, GUI_MEM_TAG_IMAGE);
+            gui_draw_image_transform(img, &o->tr, o->cache, (uint8_t *)o->cache + GUI_MEM_ALIGN(sizeof(*o->cache)));
+        }
+    }
+    return o->cache;
+}
+
 /**
  * \brief           Widget initialization structure
  */
@@ -81,7 +159,21 @@ gui_image_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
             x = gui_widget_getabsolutex(h);
             y = gui_widget_getabsolutey(h);
             
-            gui_draw_image(disp, x, y, o->image);   /* Draw actual image on screen */
+            if (o->image == NULL) {
+                return 1;
+            }
+            if (o->flags & GUI_FLAG_IMAGE_CACHED) {
+                gui_draw_image(disp, x, y, image_get_cache(o)); /* Draw image transformed only once */
+            } else if (o->flags & GUI_FLAG_IMAGE_TRANSFORM) {
+                gui_draw_image_ex(disp, x, y, image_get_source(o), &o->tr);
+            } else {
+                gui_draw_image(disp, x, y, image_get_source(o));    /* Draw actual image on screen */
+            }
+            return 1;
+        }
+        case GUI_EVT_REMOVE: {
+            GUI_MEMFREE(o->cache);                  /* Free cached image */
+            image_unpin(o);
             return 1;
         }
         default:                                    /* Handle default option */
@@ -119,11 +211,77 @@ gui_image_setsource(gui_handle_p h, const gui_image_desc_t* img) {
     gui_image_t* o = GUI_VP(h);
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget && img != NULL);
 
+    image_unpin(o);                                 /* Release previous decoded image */
     o->image = img;                                 /* Set image */
+    GUI_MEMFREE(o->cache);                          /* Cached image is not valid anymore */
     
     /* When alpha image is applied, invalidate parent */
-    gui_widget_setinvalidatewithparent(h, img != NULL && img->bpp == 32);
+    gui_widget_setinvalidatewithparent(h, img != NULL && (img->bpp == 32 || img->clut != NULL || (o->flags & GUI_FLAG_IMAGE_TRANSFORM)));
     gui_widget_invalidatewithparent(h);
 
     return 1;
 }
+
+/**
+ * \brief           Set scale and rotation of image
+ *
+ *                  Image is drawn inside widget, with top-left corner of transformed image bounding box
+ *                  at top-left corner of widget. Use \ref gui_draw_image_transformsize to get required widget size.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       tr: Transformation parameters. Set to `NULL` to draw image in original size
+ * \param[in]       cached: Set to `1` to transform image only once and keep result in memory.
+ *                      Use this mode for static images to save drawing time
+ * \return          `1` on success, `0` otherwise
+ */
+uint8_t
+gui_image_settransform(gui_handle_p h, const gui_draw_image_transform_t* tr, uint8_t cached) {
+    gui_image_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    GUI_MEMFREE(o->cache);                          /* Cached image is not valid anymore */
+    o->flags &= ~(GUI_FLAG_IMAGE_TRANSFORM | GUI_FLAG_IMAGE_CACHED);
+    if (tr != NULL) {
+        o->tr = *tr;                                /* Copy transformation parameters */
+        o->flags |= GUI_FLAG_IMAGE_TRANSFORM;
+        if (cached) {
+            o->flags |= GUI_FLAG_IMAGE_CACHED;
+        }
+    }
+
+    /* Transformed image has transparent corners, parent must be drawn first */
+    gui_widget_setinvalidatewithparent(h, tr != NULL || (o->image != NULL && (o->image->bpp == 32 || o->image->clut != NULL)));
+    gui_widget_invalidatewithparent(h);
+
+    return 1;
+}
+
+#if GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__
+
+/**
+ * \brief           Set decoder for compressed or external image source
+ *
+ *                  Image is decoded on first draw and kept in image cache.
+ *                  While widget uses decoded image, it is pinned and cannot be evicted from cache.
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       decode_fn: Decoder function. Set to `NULL` to draw source image directly
+ * \param[in]       bpp: Bits per pixel of decoded image
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_imagecache_get
+ */
+uint8_t
+gui_image_setdecoder(gui_handle_p h, gui_imagecache_decode_fn decode_fn, uint8_t bpp) {
+    gui_image_t* o = GUI_VP(h);
+    GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
+
+    image_unpin(o);                                 /* Release previous decoded image */
+    GUI_MEMFREE(o->cache);
+    o->decode_fn = decode_fn;
+    o->decode_bpp = bpp;
+    gui_widget_invalidatewithparent(h);
+
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_IMAGE_CACHE || __DOXYGEN__ */
@@ -210,9 +210,9 @@ remove_row(gui_handle_p h, void* item) {
     
     /* Remove row items (columns) first */
     while ((col = (gui_listview_item_t *)gui_linkedlist_remove_gen(&row->root, (gui_linkedlist_t *)gui_linkedlist_getnext_gen(&row->root, NULL))) != NULL) {
-        GUI_MEMFREE(col);
+        GUI_MEMPOOLFREE(col);
     }
-    GUI_MEMFREE(item);                              /* Remove item itself */
+    GUI_MEMPOOLFREE(item);                          /* Remove item itself */
     return 1;
 }
 
@@ -358,7 +358,7 @@ gui_listview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
             if (o->cols != NULL) {
                 uint16_t i = 0;
                 for (i = 0; i < o->col_count; i++) {
-                    GUI_MEMFREE(o->cols[i]);
+                    GUI_MEMPOOLFREE(o->cols[i]);
                 }
                 GUI_MEMFREE(o->cols);
             }
@@ -549,9 +549,11 @@ gui_listview_addcolumn(gui_handle_p h, const gui_char* text, gui_dim_t width) {
 
     cols = GUI_MEMREALLOC(o->cols, sizeof(*o->cols) * (o->col_count + 2));    /* Allocate new memory block for new pointers of columns */
     if (cols != NULL) {
+        GUI_MEMTAG(cols, GUI_MEM_TAG_LIST);
         o->cols = cols;                       /* Save new pointer of memory */
-        col = GUI_MEMALLOC(sizeof(*col));       /* Allocate memory for new column structure */
+        col = GUI_MEMPOOLALLOC(sizeof(*col));   /* Allocate memory for new column structure */
         if (col != NULL) {
+            GUI_MEMPOOLTAG(col, GUI_MEM_TAG_LIST);
             o->cols[o->col_count++] = col;  /* Add column to array list */
             o->cols[o->col_count] = NULL;   /* Add zero to the end of array */
             
@@ -599,8 +601,9 @@ gui_listview_addrow(gui_handle_p h) {
     
     GUI_ASSERTPARAMS(h != NULL && h->widget == &widget);
 
-    row = GUI_MEMALLOC(sizeof(*row));               /* Allocate memory for new row(s) */
+    row = GUI_MEMPOOLCALLOC(sizeof(*row));          /* Allocate memory for new row(s) */
     if (row != NULL) {
+        GUI_MEMPOOLTAG(row, GUI_MEM_TAG_LIST);
         gui_widget_list_add_item(h, &o->ld, row);
     }
     
@@ -654,10 +657,11 @@ gui_listview_setitemstring(gui_handle_p h, gui_listview_row_p row, uint16_t col,
     col++;
     while (col--) {                                 /* Find right column */
         if (item == NULL) {
-            item = GUI_MEMALLOC(sizeof(*item));     /* Allocate for item */
+            item = GUI_MEMPOOLCALLOC(sizeof(*item)); /* Allocate for item */
             if (item == NULL) {
                 break;
             }
+            GUI_MEMPOOLTAG(item, GUI_MEM_TAG_LIST);
             gui_linkedlist_add_gen(&((gui_listview_row_t *)row)->root, (gui_linkedlist_t *)item);   /* Add element to linked list */
         }
         if (col) {
@@ -248,6 +248,9 @@ gui_progbar_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* cons
                     f.color1width = w ? w - 1 : 0;
                     f.color1 = guii_widget_getcolor(h, GUI_PROGBAR_COLOR_BG);
                     f.color2 = guii_widget_getcolor(h, GUI_PROGBAR_COLOR_FG);
+#if GUI_CFG_USE_TEXT_LAYOUT
+                    f.layout = guii_widget_gettextlayout(h);  /* Reuse line breaks until text changes */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
                     gui_draw_writetext(disp, gui_widget_getfont(h), text, &f);
                 }
             }
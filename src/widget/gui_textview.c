@@ -133,6 +133,9 @@ gui_textview_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* con
                 f.flags |= GUI_FLAG_TEXT_MULTILINE; /* Enable multiline */
                 f.color1width = f.width;
                 f.color1 = guii_widget_getcolor(h, GUI_TEXTVIEW_COLOR_TEXT);
+#if GUI_CFG_USE_TEXT_LAYOUT
+                f.layout = guii_widget_gettextlayout(h);  /* Reuse line breaks until text changes */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
                 gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
             }
             return 1;
@@ -51,6 +51,13 @@ gui_widget_default_t widget_default;
 #define SET_WIDGET_ABS_VALUES(h)
 #endif
 
+/* Widget area including effects drawn outside widget */
+#if GUI_CFG_USE_EFFECTS
+#define GET_WIDGET_EFFECT_AREA(h, x1, y1, x2, y2)   guii_effect_getarea(h, x1, y1, x2, y2)
+#else
+#define GET_WIDGET_EFFECT_AREA(h, x1, y1, x2, y2)
+#endif
+
 /**
  * \brief           Calculate widget absolute width
  *                  based on relative values from all parent widgets
@@ -255,6 +262,8 @@ remove_widget(gui_handle_p h) {
      * - Free any possible memory used for text operation
      * - Remove software timer if exists
      * - Remove custom colors
+     * - Remove effects with cached data
+     * - Remove text layout cache
      * - Remove widget from its linkedlist
      * - Free widget memory
      */
@@ -267,8 +276,24 @@ remove_widget(gui_handle_p h) {
         GUI_MEMFREE(h->colors);
         h->colors = NULL;
     }
+#if GUI_CFG_USE_EFFECTS
+    guii_effect_free(h);
+#endif /* GUI_CFG_USE_EFFECTS */
+#if GUI_CFG_USE_TEXT_LAYOUT
+    if (h->layout != NULL) {
+        if (h->layout->lines != NULL) {
+            GUI_MEMFREE(h->layout->lines);
+        }
+#if GUI_CFG_USE_TEXT_RUN
+        if (h->layout->run != NULL) {
+            GUI_MEMFREE(h->layout->run);
+        }
+#endif /* GUI_CFG_USE_TEXT_RUN */
+        GUI_MEMFREE(h->layout);
+    }
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
     gui_linkedlist_widgetremove(h);                 /* Remove entry from linked list of parent widget */
-    GUI_MEMFREE(h);                                 /* Free memory for widget */
+    GUI_MEMPOOLFREE(h);                             /* Free memory for widget */
     
     return 1;                                       /* Widget deleted */
 }
@@ -374,6 +399,7 @@ set_clipping_region(gui_handle_p h) {
     
     /* Get visible widget part and absolute position on screen according to parent */
     get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    GET_WIDGET_EFFECT_AREA(h, &x1, &y1, &x2, &y2);  /* Shadow must be redrawn too */
     
     /* Possible improvement */
     /*
@@ -457,12 +483,14 @@ invalidate_widget(gui_handle_p h, uint8_t setclipping) {
 #endif /* GUI_CFG_USE_ALPHA */
     for (; h1 != NULL; h1 = gui_linkedlist_widgetgetnext(NULL, h1)) {
         get_widget_abs_visible_position_size(h1, &h1x1, &h1y1, &h1x2, &h1y2); /* Get visible position on LCD for widget */
+        GET_WIDGET_EFFECT_AREA(h1, &h1x1, &h1y1, &h1x2, &h1y2);
         
         /* Scan widgets on top of current widget */
         for (h2 = gui_linkedlist_widgetgetnext(NULL, h1); h2 != NULL;
                 h2 = gui_linkedlist_widgetgetnext(NULL, h2)) {
             /* Get visible position on second widget */
             get_widget_abs_visible_position_size(h2, &h2x1, &h2y1, &h2x2, &h2y2);
+            GET_WIDGET_EFFECT_AREA(h2, &h2x1, &h2y1, &h2x2, &h2y2);
                     
             /* Check if next widget is on top of current one */
             if (
@@ -474,6 +502,17 @@ invalidate_widget(gui_handle_p h, uint8_t setclipping) {
                 continue;
             }
             guii_widget_setflag(h2, GUI_FLAG_REDRAW);   /* Redraw widget on next loop */
+#if GUI_CFG_USE_EFFECTS
+            /*
+             * Content under shadow or blurred backdrop has changed.
+             * Whole area of widget must be drawn again from parent widget,
+             * old shadow would be drawn twice otherwise
+             */
+            if (h2->effect != NULL && guii_widget_hasparent(h2)) {
+                set_clipping_region(h2);
+                invalidate_widget(guii_widget_getparent(h2), 0);
+            }
+#endif /* GUI_CFG_USE_EFFECTS */
         }
     }
     
@@ -724,6 +763,7 @@ guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover) {
     
     /* Get widget visible section */
     get_widget_abs_visible_position_size(h, &x1, &y1, &x2, &y2);
+    GET_WIDGET_EFFECT_AREA(h, &x1, &y1, &x2, &y2);  /* Shadow is part of widget area */
 
     /* Check if widget is inside drawing area */
     if (!GUI_RECT_MATCH(
@@ -756,6 +796,9 @@ guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover) {
             /* Check if widget is inside */
             if (GUI_RECT_IS_INSIDE(x1, y1, x2, y2, tx1, ty1, tx2, ty2) &&
                 !guii_widget_getflag(tmp, GUI_FLAG_WIDGET_INVALIDATE_PARENT) &&
+#if GUI_CFG_USE_EFFECTS
+                !guii_effect_hasbackdrop(tmp) &&    /* Covered widget is visible through blur */
+#endif /* GUI_CFG_USE_EFFECTS */
                 !guii_widget_hasalpha(tmp)          /* Must not have transparency enabled */
                 ) {
                 return 0;                           /* Widget fully covered by another! */
@@ -766,6 +809,25 @@ guii_widget_isinsideclippingregion(gui_handle_p h, uint8_t check_sib_cover) {
     return 1;                                       /* We have to draw it */
 }
 
+#if GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__
+
+/**
+ * \brief           Get text layout cache of widget, allocate it on first call
+ * \note            This function is private and may be called only when OS protection is active
+ * \param[in]       h: Widget handle
+ * \return          Pointer to layout on success, `NULL` if memory is not available
+ */
+gui_text_layout_t *
+guii_widget_gettextlayout(gui_handle_p h) {
+    if (h->layout == NULL) {
+        h->layout = GUI_MEMALLOC(sizeof(*h->layout));
+        GUI_MEMTAG(h->layout, GUI_MEM_TAG_TEXT);
+    }
+    return h->layout;
+}
+
+#endif /* GUI_CFG_USE_TEXT_LAYOUT || __DOXYGEN__ */
+
 /**
  * \brief           Init widget part of library
  */
@@ -1089,6 +1151,25 @@ guii_widget_setparam(gui_handle_p h, uint16_t cfg, const void* data, uint8_t inv
     return 1;
 }
 
+#if GUI_CFG_USE_MEM_TAG && !GUI_CFG_USE_MEM_POOL
+
+/**
+ * \brief           Get allocation tag for widget handle
+ * \param[in]       widget: Pointer to \ref gui_widget_t structure with widget description
+ * \return          Tag of widget type, \ref GUI_MEM_TAG_WIDGET when widget type cannot have own tag
+ */
+static uint8_t
+widget_get_memtag(const gui_widget_t* widget) {
+    uint8_t tag = GUI_MEM_TAG_OTHER;
+
+    if (widget->name != NULL) {
+        tag = gui_mem_tag_register((const char *)widget->name);
+    }
+    return tag != GUI_MEM_TAG_OTHER ? tag : GUI_MEM_TAG_WIDGET; /* Tag table is full */
+}
+
+#endif /* GUI_CFG_USE_MEM_TAG && !GUI_CFG_USE_MEM_POOL */
+
 /**
  * \brief           Create new widget and add it to linked list to parent object
  * \note            This function may only be called from widget create function, such as \ref gui_button_create or similar
@@ -1114,11 +1195,12 @@ gui_widget_create(const gui_widget_t* widget, gui_id_t id, float x, float y, flo
         return 0;
     }
 
-    h = GUI_MEMALLOC(widget->size);                 /* Allocate memory for widget */
+    h = GUI_MEMPOOLCALLOC(widget->size);            /* Allocate memory for widget */
     if (h != NULL) {
         gui_evt_param_t param = {0};
         gui_evt_result_t result = {0};
 
+        GUI_MEMPOOLTAG(h, widget_get_memtag(widget));
         h->id = id;                                 /* Save ID */
         h->widget = widget;                         /* Widget object structure */
         h->footprint = GUI_WIDGET_FOOTPRINT;        /* Set widget footprint */
@@ -1151,7 +1233,7 @@ gui_widget_create(const gui_widget_t* widget, gui_id_t id, float x, float y, flo
         guii_widget_callback(h, GUI_EVT_PRE_INIT, NULL, &result);    /* Notify internal widget library about init successful */
         
         if (!GUI_EVT_RESULTTYPE_U8(&result)) {
-            GUI_MEMFREE(h);
+            GUI_MEMPOOLFREE(h);
             h = NULL;
         }
         
@@ -1214,6 +1296,7 @@ gui_widget_setcolor(gui_handle_p h, uint8_t index, gui_color_t color) {
         if (h->widget->color_count) {               /* Check if at least some colors should be used */
             h->colors = GUI_MEMALLOC(sizeof(*h->colors) * h->widget->color_count);
             if (h->colors != NULL) {                /* Copy all colors to new memory first */
+                GUI_MEMTAG(h->colors, GUI_MEM_TAG_WIDGET);
                 memcpy(h->colors, h->widget->colors, sizeof(*h->colors) * h->widget->color_count);
             } else {
                 ret = 0;
@@ -1387,6 +1470,7 @@ gui_widget_alloctextmemory(gui_handle_p h, uint32_t size) {
     h->textmemsize = sizeof(gui_char) * (size + 1); /* Allocate text memory */
     h->text = GUI_MEMALLOC(h->textmemsize);
     if (h->text != NULL) {                          /* Check if allocated */
+        GUI_MEMTAG(h->text, GUI_MEM_TAG_TEXT);
         guii_widget_setflag(h, GUI_FLAG_DYNAMICTEXTALLOC); /* Dynamically allocated */
     } else {
         h->textmemsize = 0;                         /* No dynamic bytes available */
@@ -1435,6 +1519,7 @@ uint8_t
 gui_widget_settext(gui_handle_p h, const gui_char* text) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
+    guii_widget_clrflag(h, GUI_FLAG_TEXTID);        /* Text is not set by ID anymore */
     if (guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC)) {   /* Memory for text is dynamically allocated */
         if (h->textmemsize) {
             if (gui_string_lengthtotal(text) > (h->textmemsize - 1)) {  /* Check string length */
@@ -1462,6 +1547,36 @@ gui_widget_settext(gui_handle_p h, const gui_char* text) {
     return 1;
 }
 
+#if GUI_CFG_USE_TRANSLATE || __DOXYGEN__
+
+/**
+ * \brief           Set text to widget by translation ID
+ *
+ *                  Text of active language is set with \ref gui_widget_settext
+ *                  and is set again each time active or source language changes
+ *
+ * \param[in]       h: Widget handle
+ * \param[in]       id: Translation ID, index of entry in source language table
+ * \return          `1` on success, `0` otherwise
+ * \sa              gui_translate_getid
+ */
+uint8_t
+gui_widget_settextid(gui_handle_p h, size_t id) {
+    const gui_char* text;
+
+    GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
+
+    if ((text = gui_translate_getid(id)) == NULL) {
+        return 0;
+    }
+    gui_widget_settext(h, text);
+    h->textid = id;                                 /* Save ID for language changes */
+    guii_widget_setflag(h, GUI_FLAG_TEXTID);
+    return 1;
+}
+
+#endif /* GUI_CFG_USE_TRANSLATE || __DOXYGEN__ */
+
 /**
  * \brief           Get text from widget
  * \note            It will return pointer to text which cannot be modified directly.
@@ -1475,8 +1590,8 @@ gui_widget_gettext(gui_handle_p h) {
     GUI_ASSERTPARAMS(guii_widget_iswidget(h));    
     
 #if GUI_CFG_USE_TRANSLATE
-    /* For static texts only */
-    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC) && h->text != NULL) {
+    /* For static texts only, texts set by ID are already translated */
+    if (!guii_widget_getflag(h, GUI_FLAG_DYNAMICTEXTALLOC | GUI_FLAG_TEXTID) && h->text != NULL) {
         t = gui_translate_get(h->text);             /* Get translation entry */
     } else 
 #endif /* GUI_CFG_USE_TRANSLATE */
@@ -168,6 +168,9 @@ gui_window_callback(gui_handle_p h, gui_widget_evt_t evt, gui_evt_param_t* const
                     f.align = GUI_HALIGN_CENTER | GUI_VALIGN_CENTER;
                     f.color1width = f.width;
                     f.color1 = guii_widget_getcolor(h, GUI_WINDOW_COLOR_TEXT);
+#if GUI_CFG_USE_TEXT_LAYOUT
+                    f.layout = guii_widget_gettextlayout(h);  /* Reuse line breaks until text changes */
+#endif /* GUI_CFG_USE_TEXT_LAYOUT */
                     gui_draw_writetext(disp, gui_widget_getfont(h), gui_widget_gettext(h), &f);
                 }
             }
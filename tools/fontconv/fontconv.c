@@ -0,0 +1,829 @@
+/**
+ * \file            fontconv.c
+ * \brief           TTF/OTF to EasyGUI font converter
+ */
+
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+
+/*
+ * Host tool, build with `make` on Linux, requires FreeType library.
+ *
+ * Usage:
+ *
+ *  fontconv -f font.ttf -s 22 [-b 1|2|4|8] [-e] [-k] [-r 0x20-0x7E] [-c chars]
+ *           [-t text.txt] [-l translations.c] [-n Name] -o out.c|out.bin
+ *
+ *  -f: Source font file
+ *  -s: Font size in units of pixels
+ *  -b: Bits per pixel, `1` for plain or `2`, `4` or `8` for anti-aliased font, default `2`
+ *  -e: Run-length encode character data, \ref GUI_FLAG_FONT_RLE
+ *  -k: Export kerning pairs from font `kern` table, \ref gui_font_kern_t
+ *  -r: Range of characters to include, can be used multiple times
+ *  -c: UTF-8 characters to include
+ *  -t: UTF-8 text file, all characters from it are included
+ *  -l: C source with translation tables, characters from all string literals are included
+ *  -n: Font name used for C symbols, default is derived from font family and size
+ *  -o: Output file. Files ending with `.bin` are written as binary assets, check \ref GUI_ASSET,
+ *      other files are written as C source
+ *
+ * When no characters are selected, printable ASCII range is used.
+ * Character `?` is always included as it is used for missing characters.
+ * C source output includes advance width table of ASCII characters, \ref gui_text_getadvance.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <ctype.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+
+#define MAX_CHAR            0xFFFF          /* Fonts use 16-bit start and end character */
+#define FLAG_FONT_AA        0x01            /* Same as GUI_FLAG_FONT_AA */
+#define FLAG_FONT_RLE       0x10            /* Same as GUI_FLAG_FONT_RLE */
+#define FLAG_FONT_AA4       0x20            /* Same as GUI_FLAG_FONT_AA4 */
+#define FLAG_FONT_AA8       0x40            /* Same as GUI_FLAG_FONT_AA8 */
+
+/**
+ * \brief           Converted character
+ */
+typedef struct {
+    uint32_t code;                          /*!< Unicode code point */
+    uint8_t x_size;                         /*!< Width including left bearing */
+    uint8_t y_size;                         /*!< Height */
+    uint8_t y_pos;                          /*!< Offset from top of line */
+    uint8_t x_margin;                       /*!< Space after character */
+    uint8_t* data;                          /*!< Encoded character data */
+    size_t len;                             /*!< Length of encoded data */
+    size_t raw_len;                         /*!< Length of data without run-length encoding */
+} conv_char_t;
+
+/**
+ * \brief           Range of consecutive characters
+ */
+typedef struct {
+    uint32_t first;                         /*!< First character in range */
+    uint32_t last;                          /*!< Last character in range */
+    uint32_t index;                         /*!< Index of first character */
+} conv_range_t;
+
+/**
+ * \brief           Kerning pair of character indexes
+ */
+typedef struct {
+    uint16_t first;                         /*!< Left character index */
+    uint16_t second;                        /*!< Right character index */
+    int8_t value;                           /*!< Adjustment in units of pixels */
+} conv_kern_t;
+
+/**
+ * \brief           Growing byte buffer
+ */
+typedef struct {
+    uint8_t* data;                          /*!< Buffer data */
+    size_t len;                             /*!< Number of used bytes */
+    size_t size;                            /*!< Allocated size */
+} buff_t;
+
+static uint8_t selected[MAX_CHAR + 1];      /* Characters to include in font */
+static conv_char_t chars[MAX_CHAR + 1];
+static size_t chars_count;
+static conv_range_t ranges[MAX_CHAR + 1];
+static size_t ranges_count;
+static conv_kern_t* kerning;
+static size_t kerning_count;
+static uint8_t bpp = 2, rle, kern;
+
+/**
+ * \brief           Print error and exit
+ */
+static void
+fail(const char* msg, const char* arg) {
+    fprintf(stderr, "fontconv: %s%s%s\n", msg, arg != NULL ? ": " : "", arg != NULL ? arg : "");
+    exit(1);
+}
+
+/**
+ * \brief           Append byte to buffer
+ */
+static void
+buff_put(buff_t* b, uint8_t v) {
+    if (b->len == b->size) {
+        b->size = b->size ? 2 * b->size : 256;
+        b->data = realloc(b->data, b->size);
+        if (b->data == NULL) {
+            fail("out of memory", NULL);
+        }
+    }
+    b->data[b->len++] = v;
+}
+
+/**
+ * \brief           Decode UTF-8 character
+ * \param[in,out]   s: Pointer to string pointer, advanced to next character
+ * \return          Code point, `0xFFFD` for invalid sequence
+ */
+static uint32_t
+utf8_decode(const uint8_t** s) {
+    const uint8_t* p = *s;
+    uint32_t c = *p++;
+    int n = 0;
+
+    if (c >= 0xF0) {
+        c &= 0x07, n = 3;
+    } else if (c >= 0xE0) {
+        c &= 0x0F, n = 2;
+    } else if (c >= 0xC0) {
+        c &= 0x1F, n = 1;
+    } else if (c >= 0x80) {
+        c = 0xFFFD;
+    }
+    for (; n > 0 && (*p & 0xC0) == 0x80; n--) {
+        c = (c << 6) | (*p++ & 0x3F);
+    }
+    *s = p;
+    return n ? 0xFFFD : c;
+}
+
+/**
+ * \brief           Select all printable characters of UTF-8 string
+ */
+static void
+select_text(const uint8_t* s, const uint8_t* end) {
+    uint32_t c;
+
+    while (s < end && *s) {
+        c = utf8_decode(&s);
+        if (c >= 0x20 && c <= MAX_CHAR && c != 0xFFFD) {
+            selected[c] = 1;
+        } else if (c > MAX_CHAR) {
+            fprintf(stderr, "fontconv: character U+%04X not supported, skipped\n", (unsigned)c);
+        }
+    }
+}
+
+/**
+ * \brief           Read complete file to memory
+ */
+static uint8_t*
+read_file(const char* path, size_t* len) {
+    FILE* f = fopen(path, "rb");
+    uint8_t* data;
+    long n;
+
+    if (f == NULL) {
+        fail("cannot open file", path);
+    }
+    fseek(f, 0, SEEK_END);
+    n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)n + 1);
+    if (data == NULL || fread(data, 1, (size_t)n, f) != (size_t)n) {
+        fail("cannot read file", path);
+    }
+    data[n] = 0;
+    fclose(f);
+    *len = (size_t)n;
+    return data;
+}
+
+/**
+ * \brief           Select characters from all string literals in C source
+ *
+ *                  Comments and character constants are skipped,
+ *                  simple and hexadecimal escape sequences are decoded
+ */
+static void
+select_csource(const char* path) {
+    size_t len, i;
+    uint8_t* s = read_file(path, &len);
+    buff_t str = {0};
+
+    for (i = 0; i < len; i++) {
+        if (s[i] == '/' && s[i + 1] == '/') {
+            while (i < len && s[i] != '\n') {
+                i++;
+            }
+        } else if (s[i] == '/' && s[i + 1] == '*') {
+            for (i += 2; i < len && !(s[i] == '*' && s[i + 1] == '/'); i++) {}
+            i++;
+        } else if (s[i] == '\'') {
+            for (i++; i < len && s[i] != '\''; i++) {
+                if (s[i] == '\\') {
+                    i++;
+                }
+            }
+        } else if (s[i] == '"') {
+            str.len = 0;
+            for (i++; i < len && s[i] != '"'; i++) {
+                if (s[i] == '\\' && i + 1 < len) {
+                    i++;
+                    switch (s[i]) {
+                        case 'x': {
+                            unsigned v = 0;
+                            while (i + 1 < len && isxdigit(s[i + 1])) {
+                                i++;
+                                v = v * 16 + (isdigit(s[i]) ? s[i] - '0' : (tolower(s[i]) - 'a' + 10));
+                            }
+                            buff_put(&str, (uint8_t)v);
+                            break;
+                        }
+                        case 'n': case 't': case 'r': case '0':
+                            break;                  /* Control characters are not drawn */
+                        default:
+                            buff_put(&str, s[i]);
+                            break;
+                    }
+                } else {
+                    buff_put(&str, s[i]);
+                }
+            }
+            select_text(str.data, str.data + str.len);
+        }
+    }
+    free(str.data);
+    free(s);
+}
+
+/**
+ * \brief           Select range of characters in `first-last` or single character format
+ */
+static void
+select_range(const char* arg) {
+    char* end;
+    unsigned long first, last;
+
+    first = strtoul(arg, &end, 0);
+    last = *end == '-' ? strtoul(end + 1, &end, 0) : first;
+    if (*end || first > last || last > MAX_CHAR) {
+        fail("invalid range", arg);
+    }
+    for (; first <= last; first++) {
+        selected[first] = 1;
+    }
+}
+
+/**
+ * \brief           Encode coverage values with run-length packets
+ *
+ *                  Same format as decoded by \ref gui_text_rle_getspan:
+ *                  `0 V nnnnn` run of `n + 1` pixels or `1 nnnnnnn` literal of `n + 1` packed pixels.
+ *                  With `8` bits per pixel, run is `0 nnnnnnn` followed by value byte.
+ *                  Short runs are kept in literals as run packets would make data larger
+ *
+ * \param[in]       lv: Coverage values at font bits per pixel
+ * \param[in]       n: Number of values
+ * \param[out]      out: Output buffer
+ */
+static void
+encode_rle(const uint8_t* lv, size_t n, buff_t* out) {
+    size_t i = 0, run, lit_start = 0, lit_len = 0, k, maxrun = bpp == 8 ? 128 : (size_t)1 << (7 - bpp);
+    size_t threshold = bpp == 1 ? 16 : bpp == 2 ? 9 : bpp == 4 ? 5 : 4;
+
+    while (i <= n) {
+        run = 0;
+        if (i < n) {
+            for (run = 1; i + run < n && lv[i + run] == lv[i]; run++) {}
+        }
+        if (i == n || run >= threshold) {
+            /* Flush pending literal in chunks of 128 pixels */
+            while (lit_len > 0) {
+                size_t cnt = lit_len > 128 ? 128 : lit_len, ppb = 8 / bpp;
+                buff_put(out, (uint8_t)(0x80 | (cnt - 1)));
+                for (k = 0; k < cnt; k += ppb) {
+                    uint8_t b = 0;
+                    size_t j;
+                    for (j = 0; j < ppb && k + j < cnt; j++) {
+                        b |= lv[lit_start + k + j] << (8 - bpp * (j + 1));
+                    }
+                    buff_put(out, b);
+                }
+                lit_start += cnt;
+                lit_len -= cnt;
+            }
+            if (i == n) {
+                break;
+            }
+            for (k = run; k > 0; ) {
+                size_t cnt = k > maxrun ? maxrun : k;
+                if (bpp == 8) {
+                    buff_put(out, (uint8_t)(cnt - 1));
+                    buff_put(out, lv[i]);
+                } else {
+                    buff_put(out, (uint8_t)((lv[i] << (7 - bpp)) | (cnt - 1)));
+                }
+                k -= cnt;
+            }
+            i += run;
+            lit_start = i;
+        } else {
+            lit_len += run;
+            i += run;
+        }
+    }
+}
+
+/**
+ * \brief           Encode coverage values as rows aligned to bytes, most significant bits first
+ */
+static void
+encode_raw(const uint8_t* lv, uint8_t w, uint8_t h, buff_t* out) {
+    size_t x, y, ppb = 8 / bpp, cols = (w + ppb - 1) / ppb;
+    uint8_t b;
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < cols * ppb; x += ppb) {
+            size_t j;
+            for (b = 0, j = 0; j < ppb && x + j < w; j++) {
+                b |= lv[y * w + x + j] << (8 - bpp * (j + 1));
+            }
+            buff_put(out, b);
+        }
+    }
+}
+
+/**
+ * \brief           Render and encode single character
+ */
+static void
+convert_char(FT_Face face, uint32_t code, int ascender) {
+    FT_GlyphSlot g = face->glyph;
+    conv_char_t* c = &chars[chars_count];
+    buff_t out = {0}, raw = {0};
+    uint8_t* lv;
+    int left, top, w, h, x, y, advance, max = (1 << bpp) - 1;
+
+    if (FT_Load_Char(face, code, FT_LOAD_RENDER | (bpp == 1 ? FT_LOAD_TARGET_MONO : FT_LOAD_TARGET_NORMAL))) {
+        fprintf(stderr, "fontconv: cannot render U+%04X, skipped\n", (unsigned)code);
+        return;
+    }
+
+    /* Characters are drawn at pen position, left bearing is part of bitmap */
+    left = g->bitmap_left > 0 ? g->bitmap_left : 0;
+    top = ascender - g->bitmap_top;
+    if (top < 0) {
+        top = 0;
+    }
+    w = left + (int)g->bitmap.width;
+    h = (int)g->bitmap.rows;
+    advance = (int)((g->advance.x + 32) >> 6);
+    if (h == 0 || g->bitmap.width == 0) {           /* Empty character, single blank line */
+        w = advance;
+        h = 1;
+    }
+    if (w > 255 || h > 255 || top > 255) {
+        fail("character too large", NULL);
+    }
+
+    lv = calloc((size_t)w * (size_t)h, 1);
+    for (y = 0; y < (int)g->bitmap.rows; y++) {
+        const uint8_t* row = g->bitmap.buffer + y * g->bitmap.pitch;
+        for (x = 0; x < (int)g->bitmap.width; x++) {
+            uint8_t v;
+            if (g->bitmap.pixel_mode == FT_PIXEL_MODE_MONO) {
+                v = (row[x >> 3] >> (7 - (x & 7))) & 0x01;
+            } else {
+                v = (uint8_t)((row[x] * max + 127) / 255);
+            }
+            lv[y * w + left + x] = v;
+        }
+    }
+
+    encode_raw(lv, (uint8_t)w, (uint8_t)h, &raw);
+    if (rle) {
+        encode_rle(lv, (size_t)w * (size_t)h, &out);
+        free(raw.data);
+    } else {
+        out = raw;
+    }
+
+    c->code = code;
+    c->x_size = (uint8_t)w;
+    c->y_size = (uint8_t)h;
+    c->y_pos = (uint8_t)top;
+    c->x_margin = (uint8_t)(advance > w ? advance - w : 0);
+    c->data = out.data;
+    c->len = out.len;
+    c->raw_len = raw.len;
+    chars_count++;
+    free(lv);
+}
+
+/**
+ * \brief           Get kerning pairs of all converted characters, sorted by first and second index
+ */
+static void
+convert_kerning(FT_Face face) {
+    FT_UInt* glyphs;
+    FT_Vector delta;
+    size_t i, k, size = 0;
+    long v;
+
+    if (!FT_HAS_KERNING(face)) {
+        fprintf(stderr, "fontconv: font has no kern table, kerning not exported\n");
+        return;
+    }
+    glyphs = calloc(chars_count, sizeof(*glyphs));
+    for (i = 0; i < chars_count; i++) {
+        glyphs[i] = FT_Get_Char_Index(face, chars[i].code);
+    }
+    for (i = 0; i < chars_count; i++) {
+        for (k = 0; k < chars_count; k++) {
+            if (FT_Get_Kerning(face, glyphs[i], glyphs[k], FT_KERNING_DEFAULT, &delta)) {
+                continue;
+            }
+            v = (delta.x + 32) >> 6;                /* Grid fitted value in 26.6 format */
+            if (v == 0) {
+                continue;
+            }
+            if (kerning_count == size) {
+                size = size ? 2 * size : 256;
+                kerning = realloc(kerning, size * sizeof(*kerning));
+                if (kerning == NULL) {
+                    fail("out of memory", NULL);
+                }
+            }
+            kerning[kerning_count].first = (uint16_t)i;
+            kerning[kerning_count].second = (uint16_t)k;
+            kerning[kerning_count].value = (int8_t)(v < -128 ? -128 : (v > 127 ? 127 : v));
+            kerning_count++;
+        }
+    }
+    if (kerning_count > 0xFFFF) {
+        fail("too many kerning pairs", NULL);
+    }
+    free(glyphs);
+}
+
+/**
+ * \brief           Get advance widths of characters `0x20-0x7F`, as used by \ref gui_text_getadvance
+ *
+ *                  Characters not in font use width of replacement character `?`
+ *
+ * \param[out]      adv: Output array of `0x60` widths
+ * \return          `1` on success, `0` if any width does not fit to `8` bits
+ */
+static int
+get_advance(uint8_t* adv) {
+    size_t i, k, q = 0;
+    unsigned w;
+
+    for (k = 0; k < chars_count; k++) {
+        if (chars[k].code == '?') {
+            q = k;
+        }
+    }
+    for (i = 0, k = 0; i < 0x60; i++) {
+        while (k < chars_count && chars[k].code < 0x20 + i) {
+            k++;
+        }
+        w = k < chars_count && chars[k].code == 0x20 + i ? chars[k].x_size + chars[k].x_margin : chars[q].x_size + chars[q].x_margin;
+        if (w > 255) {
+            return 0;
+        }
+        adv[i] = (uint8_t)w;
+    }
+    return 1;
+}
+
+/**
+ * \brief           Write font as C source in format of fonts in `src/fonts`
+ */
+static void
+write_c(FILE* f, const char* name, const char* title, uint8_t size, uint8_t flags) {
+    size_t i, k;
+    uint8_t adv[0x60];
+    int has_adv = get_advance(adv);
+
+    fprintf(f, "#include \"gui/gui.h\"\n\n");
+    for (i = 0; i < chars_count; i++) {
+        fprintf(f, "gui_const uint8_t Font_%s_%04x[%u] = {", name, (unsigned)chars[i].code, (unsigned)chars[i].len);
+        for (k = 0; k < chars[i].len; k++) {
+            fprintf(f, "%s0x%02X,", (k % 16) ? " " : "\n    ", chars[i].data[k]);
+        }
+        fprintf(f, "\n};\n\n");
+    }
+    fprintf(f, "gui_const gui_font_char_t %s_CharTable[] = {\n", name);
+    for (i = 0; i < chars_count; i++) {
+        fprintf(f, "{%4u, %4u, %2u, %4u, %4u, Font_%s_%04x},\n",
+            chars[i].x_size, chars[i].y_size, 0, chars[i].y_pos, chars[i].x_margin, name, (unsigned)chars[i].code);
+    }
+    fprintf(f, "};\n\n");
+    if (ranges_count > 1) {
+        fprintf(f, "gui_const gui_font_range_t %s_Ranges[] = {\n", name);
+        for (i = 0; i < ranges_count; i++) {
+            fprintf(f, "    {0x%04x, 0x%04x, %4u},\n", (unsigned)ranges[i].first, (unsigned)ranges[i].last, (unsigned)ranges[i].index);
+        }
+        fprintf(f, "};\n\n");
+    }
+    if (kerning_count > 0) {
+        fprintf(f, "gui_const gui_font_kern_t %s_Kerning[] = {\n", name);
+        for (i = 0; i < kerning_count; i++) {
+            fprintf(f, "    {%4u, %4u, %3d},\n", kerning[i].first, kerning[i].second, kerning[i].value);
+        }
+        fprintf(f, "};\n\n");
+        fprintf(f, "gui_const uint16_t %s_KerningIndex[] = {", name);
+        for (i = 0, k = 0; i <= chars_count; i++) {
+            while (k < kerning_count && kerning[k].first < i) {
+                k++;
+            }
+            fprintf(f, "%s%u,", (i % 16) ? " " : "\n    ", (unsigned)k);
+        }
+        fprintf(f, "\n};\n\n");
+    }
+    if (has_adv) {
+        fprintf(f, "gui_const uint8_t %s_Advance[%u] = {", name, (unsigned)sizeof(adv));
+        for (i = 0; i < sizeof(adv); i++) {
+            fprintf(f, "%s%u,", (i % 16) ? " " : "\n    ", adv[i]);
+        }
+        fprintf(f, "\n};\n\n");
+    }
+    fprintf(f, "gui_const gui_font_t GUI_Font_%s = {\n", name);
+    fprintf(f, "    _GT(\"%s\"),\n    %u,\n    0x%04x,\n    0x%04x,\n", title, size, (unsigned)chars[0].code, (unsigned)chars[chars_count - 1].code);
+    fprintf(f, "    %s%s%s%s%s,\n", flags ? "" : "0",
+        (flags & FLAG_FONT_AA) ? "GUI_FLAG_FONT_AA" : "",
+        (flags & FLAG_FONT_AA4) ? " | GUI_FLAG_FONT_AA4" : (flags & FLAG_FONT_AA8) ? " | GUI_FLAG_FONT_AA8" : "",
+        (flags & FLAG_FONT_AA) && (flags & FLAG_FONT_RLE) ? " | " : "",
+        (flags & FLAG_FONT_RLE) ? "GUI_FLAG_FONT_RLE" : "");
+    fprintf(f, "    %s_CharTable,\n", name);
+    if (ranges_count > 1) {
+        fprintf(f, "    %s_Ranges,\n    GUI_COUNT_OF(%s_Ranges)", name, name);
+    } else {
+        fprintf(f, "    NULL,\n    0");
+    }
+    if (kerning_count > 0) {
+        fprintf(f, ",\n    %s_Kerning,\n    %s_KerningIndex", name, name);
+    } else {
+        fprintf(f, ",\n    NULL,\n    NULL");
+    }
+    if (has_adv) {
+        fprintf(f, ",\n    %s_Advance", name);
+    } else {
+        fprintf(f, ",\n    NULL");
+    }
+    fprintf(f, "\n};\n");
+}
+
+/**
+ * \brief           Append little endian value to buffer
+ */
+static void
+put_le(buff_t* b, uint32_t v, int n) {
+    for (; n > 0; n--, v >>= 8) {
+        buff_put(b, (uint8_t)v);
+    }
+}
+
+/**
+ * \brief           Write font as binary asset, check \ref GUI_ASSET for format
+ */
+static void
+write_bin(FILE* f, const char* title, uint8_t size, uint8_t flags) {
+    buff_t b = {0};
+    size_t i, name_len = strlen(title) + 1;
+    uint32_t chars_offset = 56, ranges_offset, kerning_offset, data_offset, data_size, off;
+
+    ranges_offset = chars_offset + 16 * (uint32_t)chars_count;
+    kerning_offset = ranges_offset + 12 * (uint32_t)ranges_count;
+    data_offset = (kerning_offset + 6 * (uint32_t)kerning_count + 3) & ~3UL;
+    data_size = (uint32_t)name_len;
+    for (i = 0; i < chars_count; i++) {
+        data_size += (uint32_t)chars[i].len;
+    }
+
+    /* Header and font section */
+    put_le(&b, 'E' | ('G' << 8) | ('U' << 16) | ((uint32_t)'I' << 24), 4);
+    put_le(&b, 2, 1);                               /* Version */
+    put_le(&b, 1, 1);                               /* Font type */
+    put_le(&b, 0, 2);
+    put_le(&b, data_offset, 4);
+    put_le(&b, data_size, 4);
+    put_le(&b, size, 1);
+    put_le(&b, flags, 1);
+    put_le(&b, 0, 2);
+    put_le(&b, chars[0].code, 4);
+    put_le(&b, chars[chars_count - 1].code, 4);
+    put_le(&b, (uint32_t)chars_count, 4);
+    put_le(&b, (uint32_t)ranges_count, 4);
+    put_le(&b, data_offset, 4);                     /* Name is first in data region */
+    put_le(&b, chars_offset, 4);
+    put_le(&b, ranges_offset, 4);
+    put_le(&b, (uint32_t)kerning_count, 4);
+    put_le(&b, kerning_offset, 4);
+
+    /* Tables */
+    for (i = 0, off = data_offset + (uint32_t)name_len; i < chars_count; off += (uint32_t)chars[i].len, i++) {
+        put_le(&b, chars[i].x_size, 1);
+        put_le(&b, chars[i].y_size, 1);
+        put_le(&b, 0, 1);
+        put_le(&b, chars[i].y_pos, 1);
+        put_le(&b, chars[i].x_margin, 1);
+        put_le(&b, 0, 3);
+        put_le(&b, off, 4);
+        put_le(&b, (uint32_t)chars[i].len, 4);
+    }
+    for (i = 0; i < ranges_count; i++) {
+        put_le(&b, ranges[i].first, 4);
+        put_le(&b, ranges[i].last, 4);
+        put_le(&b, ranges[i].index, 4);
+    }
+    for (i = 0; i < kerning_count; i++) {
+        put_le(&b, kerning[i].first, 2);
+        put_le(&b, kerning[i].second, 2);
+        put_le(&b, (uint8_t)kerning[i].value, 1);
+        put_le(&b, 0, 1);
+    }
+    while (b.len < data_offset) {
+        buff_put(&b, 0);
+    }
+
+    /* Data region */
+    for (i = 0; i < name_len; i++) {
+        buff_put(&b, (uint8_t)title[i]);
+    }
+    fwrite(b.data, 1, b.len, f);
+    for (i = 0; i < chars_count; i++) {
+        fwrite(chars[i].data, 1, chars[i].len, f);
+    }
+    free(b.data);
+}
+
+int
+main(int argc, char** argv) {
+    const char *font_path = NULL, *out_path = NULL, *name = NULL;
+    char sym[96], title[96];
+    size_t i, k, data_len = 0, raw_len = 0, table_len;
+    int px = 0, any = 0, ascender, descender, binary;
+    uint8_t flags;
+    FT_Library lib;
+    FT_Face face;
+
+    for (i = 1; i < (size_t)argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < (size_t)argc ? argv[i + 1] : NULL;
+        if (!strcmp(a, "-e")) {
+            rle = 1;
+            continue;
+        }
+        if (!strcmp(a, "-k")) {
+            kern = 1;
+            continue;
+        }
+        if (a[0] != '-' || v == NULL) {
+            fail("invalid argument, check source file for usage", a);
+        }
+        i++;
+        switch (a[1]) {
+            case 'f': font_path = v; break;
+            case 's': px = atoi(v); break;
+            case 'b': bpp = (uint8_t)atoi(v); break;
+            case 'r': select_range(v); any = 1; break;
+            case 'c': select_text((const uint8_t *)v, (const uint8_t *)v + strlen(v)); any = 1; break;
+            case 't': {
+                size_t len;
+                uint8_t* s = read_file(v, &len);
+                select_text(s, s + len);
+                free(s);
+                any = 1;
+                break;
+            }
+            case 'l': select_csource(v); any = 1; break;
+            case 'n': name = v; break;
+            case 'o': out_path = v; break;
+            default: fail("unknown option", a);
+        }
+    }
+    if (font_path == NULL || out_path == NULL || px <= 0 || px > 255) {
+        fail("font file, size and output file are required", NULL);
+    }
+    if (bpp != 1 && bpp != 2 && bpp != 4 && bpp != 8) {
+        fail("bits per pixel must be 1, 2, 4 or 8", NULL);
+    }
+    if (!any) {
+        select_range("0x20-0x7E");
+    }
+    selected['?'] = 1;
+
+    if (FT_Init_FreeType(&lib) || FT_New_Face(lib, font_path, 0, &face)) {
+        fail("cannot load font", font_path);
+    }
+    if (FT_Set_Pixel_Sizes(face, 0, (FT_UInt)px)) {
+        fail("cannot set font size", NULL);
+    }
+    ascender = (int)((face->size->metrics.ascender + 32) >> 6);
+    descender = (int)((face->size->metrics.descender - 32) >> 6);
+
+    /* Render characters and build ranges of consecutive characters */
+    for (i = 0x20; i <= MAX_CHAR; i++) {
+        if (!selected[i]) {
+            continue;
+        }
+        if (FT_Get_Char_Index(face, (FT_ULong)i) == 0 && i != ' ') {
+            fprintf(stderr, "fontconv: U+%04X not in font, skipped\n", (unsigned)i);
+            continue;
+        }
+        k = chars_count;
+        convert_char(face, (uint32_t)i, ascender);
+        if (k == chars_count) {
+            continue;
+        }
+        if (ranges_count > 0 && ranges[ranges_count - 1].last + 1 == i) {
+            ranges[ranges_count - 1].last = (uint32_t)i;
+        } else {
+            ranges[ranges_count].first = ranges[ranges_count].last = (uint32_t)i;
+            ranges[ranges_count].index = (uint32_t)chars_count - 1;
+            ranges_count++;
+        }
+    }
+    if (chars_count == 0) {
+        fail("no characters converted", NULL);
+    }
+    if (kern) {
+        convert_kerning(face);
+    }
+
+    /* Build symbol name and font title */
+    snprintf(title, sizeof(title), "%s %s %d%s", face->family_name, face->style_name, px, bpp > 1 ? " AA" : "");
+    snprintf(sym, sizeof(sym), "%s", name != NULL ? name : title);
+    for (i = 0; sym[i]; i++) {
+        if (!isalnum((unsigned char)sym[i])) {
+            sym[i] = '_';
+        }
+    }
+
+    flags = (bpp > 1 ? FLAG_FONT_AA : 0) | (bpp == 4 ? FLAG_FONT_AA4 : 0) | (bpp == 8 ? FLAG_FONT_AA8 : 0) | (rle ? FLAG_FONT_RLE : 0);
+    binary = strlen(out_path) > 4 && !strcmp(out_path + strlen(out_path) - 4, ".bin");
+    {
+        FILE* f = fopen(out_path, binary ? "wb" : "w");
+        if (f == NULL) {
+            fail("cannot create output", out_path);
+        }
+        if (binary) {
+            write_bin(f, title, (uint8_t)(ascender - descender), flags);
+        } else {
+            write_c(f, sym, title, (uint8_t)(ascender - descender), flags);
+        }
+        fclose(f);
+    }
+
+    /* Size report */
+    for (i = 0; i < chars_count; i++) {
+        data_len += chars[i].len;
+        raw_len += chars[i].raw_len;
+    }
+    table_len = chars_count * (binary ? 16 : 12) + (ranges_count > 1 ? ranges_count * 12 : 0);
+    if (kerning_count > 0) {
+        table_len += kerning_count * 6 + (binary ? 0 : (chars_count + 1) * 2);
+    }
+    if (!binary && get_advance((uint8_t [0x60]){0})) {
+        table_len += 0x60;
+    }
+    printf("%s: %u characters in %u ranges, %u bpp%s\n", title, (unsigned)chars_count, (unsigned)ranges_count,
+        bpp, rle ? ", run-length encoded" : "");
+    printf("  character data: %8u bytes", (unsigned)data_len);
+    if (rle) {
+        printf(" (%u bytes raw, %.1f%%)", (unsigned)raw_len, 100.0 * (double)data_len / (double)raw_len);
+    }
+    printf("\n  tables:         %8u bytes", (unsigned)table_len);
+    if (kerning_count > 0) {
+        printf(" (%u kerning pairs)", (unsigned)kerning_count);
+    }
+    printf("\n");
+    printf("  total:          %8u bytes\n", (unsigned)(data_len + table_len));
+
+    for (i = 0; i < chars_count; i++) {
+        free(chars[i].data);
+    }
+    free(kerning);
+    FT_Done_Face(face);
+    FT_Done_FreeType(lib);
+    return 0;
+}
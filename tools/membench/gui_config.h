@@ -0,0 +1,15 @@
+/**
+ * \file            gui_config.h
+ * \brief           Host configuration for allocator benchmark
+ */
+#ifndef GUI_HDR_CONFIG_H
+#define GUI_HDR_CONFIG_H
+
+#define GUI_CFG_OS                              0
+#define GUI_CFG_USE_MEM                         1
+#define GUI_CFG_MEM_ALIGNMENT                   8
+
+/* After user configuration, call default config to merge config together */
+#include "gui/gui_config_default.h"
+
+#endif /* GUI_HDR_CONFIG_H */
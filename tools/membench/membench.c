@@ -0,0 +1,234 @@
+/**
+ * \file            membench.c
+ * \brief           Host benchmark of GUI memory manager
+ *
+ * Simulates widget create/destroy churn of screen switching:
+ * screens with widgets, texts and list rows are created and destroyed
+ * while long-lived cache entries are allocated and released in between.
+ * Build twice, once per allocator, and compare output.
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+#include "gui/gui.h"
+
+#define HEAP_SIZE           (256 * 1024)
+#define STEPS               5000
+#define MAX_SCREENS         4
+#define MAX_SCREEN_ALLOCS   1024
+#define MAX_CACHE           512
+#define MAX_SAMPLES         (2 * 1024 * 1024)
+
+typedef struct {
+    uint32_t t[MAX_SAMPLES];
+    size_t n;
+} samples_t;
+
+typedef struct {
+    void* ptr[MAX_SCREEN_ALLOCS];
+    size_t size[MAX_SCREEN_ALLOCS];                 /* Object size for pool allocations, `0` for heap */
+    size_t count;
+} screen_t;
+
+static uint64_t heap[HEAP_SIZE / sizeof(uint64_t)];
+static screen_t screens[MAX_SCREENS];
+static void* cache[MAX_CACHE];
+
+/* Timings of fixed size objects (index 1) and other allocations (index 0) */
+static samples_t t_alloc[2], t_free[2];
+static size_t n_fail;
+static uint32_t rnd_state = 0x12345678;
+
+/* Widget handle sizes, close to real widgets on 32-bit target */
+static const size_t widget_sizes[] = { 120, 112, 116, 128, 164, 140, 132, 148 };
+
+static uint32_t
+rnd(uint32_t max) {
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state % max;
+}
+
+static uint32_t
+now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint32_t)((uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec);
+}
+
+/* Allocate fixed size objects from pools when enabled, zeroed only when object needs it */
+static void*
+bench_alloc(size_t size, uint8_t fixed, uint8_t zero) {
+    uint32_t t;
+    void* ptr;
+
+    t = now_ns();
+#if GUI_CFG_USE_MEM_POOL
+    if (fixed) {
+        ptr = zero ? gui_mem_pool_calloc(size) : gui_mem_pool_alloc(size);
+    } else {
+        ptr = gui_mem_calloc(1, size);
+    }
+#else
+    (void)fixed;
+    (void)zero;
+    ptr = gui_mem_calloc(1, size);
+#endif /* GUI_CFG_USE_MEM_POOL */
+    t = now_ns() - t;
+    if (t_alloc[fixed].n < MAX_SAMPLES) {
+        t_alloc[fixed].t[t_alloc[fixed].n++] = t;
+    }
+    if (ptr == NULL) {
+        n_fail++;
+    } else {
+        memset(ptr, 0xA5, size);                    /* Touch memory as widget init would */
+    }
+    return ptr;
+}
+
+static void
+bench_free(void* ptr, size_t size) {
+    uint32_t t;
+
+    if (ptr == NULL) {
+        return;
+    }
+    t = now_ns();
+#if GUI_CFG_USE_MEM_POOL
+    if (size) {
+        gui_mem_pool_free(ptr);
+    } else {
+        gui_mem_free(ptr);
+    }
+#else
+    (void)size;
+    gui_mem_free(ptr);
+#endif /* GUI_CFG_USE_MEM_POOL */
+    t = now_ns() - t;
+    if (t_free[size > 0].n < MAX_SAMPLES) {
+        t_free[size > 0].t[t_free[size > 0].n++] = t;
+    }
+}
+
+static void
+screen_add(screen_t* s, size_t size, uint8_t fixed, uint8_t zero) {
+    if (s->count < MAX_SCREEN_ALLOCS) {
+        s->size[s->count] = fixed ? size : 0;
+        s->ptr[s->count++] = bench_alloc(size, fixed, zero);
+    }
+}
+
+static void
+screen_create(screen_t* s) {
+    size_t widgets, rows, cols;
+
+    s->count = 0;
+    screen_add(s, 180, 1, 1);                          /* Window */
+    widgets = 5 + rnd(25);
+    while (widgets--) {
+        screen_add(s, widget_sizes[rnd(sizeof(widget_sizes) / sizeof(widget_sizes[0]))], 1, 1);
+        if (rnd(2)) {
+            screen_add(s, 8 + rnd(56), 0, 1);          /* Dynamic text */
+        }
+        if (rnd(10) == 0) {                         /* List view with rows */
+            cols = 1 + rnd(4);
+            rows = 10 + rnd(50);
+            while (rows--) {
+                screen_add(s, 2 * sizeof(void*), 1, 1);    /* Row */
+                for (size_t c = 0; c < cols; c++) {
+                    screen_add(s, 3 * sizeof(void*), 1, 1); /* Row item */
+                }
+            }
+        }
+    }
+}
+
+static void
+screen_destroy(screen_t* s) {
+    while (s->count) {                              /* Children are removed before parents */
+        --s->count;
+        bench_free(s->ptr[s->count], s->size[s->count]);
+    }
+}
+
+static int
+cmp_u32(const void* a, const void* b) {
+    uint32_t x = *(const uint32_t*)a, y = *(const uint32_t*)b;
+    return x < y ? -1 : x > y;
+}
+
+static void
+report(const char* name, samples_t* samples) {
+    uint32_t* t = samples->t;
+    size_t n = samples->n;
+    uint64_t sum = 0;
+
+    if (n == 0) {
+        return;
+    }
+    for (size_t i = 0; i < n; i++) {
+        sum += t[i];
+    }
+    qsort(t, n, sizeof(*t), cmp_u32);
+    printf("%-12s %8zu ops, avg %6.1f ns, p99 %6u ns, p99.9 %6u ns, max %7u ns\r\n",
+        name, n, (double)sum / n, (unsigned)t[n * 99 / 100], (unsigned)t[n * 999 / 1000], (unsigned)t[n - 1]);
+}
+
+int
+main(void) {
+    const gui_mem_region_t regions[] = {
+        { heap, sizeof(heap) * 3 / 4 },
+        { (uint8_t*)heap + sizeof(heap) * 3 / 4, sizeof(heap) / 4 },
+    };
+    size_t idx;
+
+    memset(t_alloc, 0x00, sizeof(t_alloc));         /* Fault in sample buffers before measuring */
+    memset(t_free, 0x00, sizeof(t_free));
+    if (!gui_mem_assignmemory(regions, sizeof(regions) / sizeof(regions[0]))) {
+        printf("Cannot assign memory\r\n");
+        return 1;
+    }
+    printf("Allocator: %s%s, heap %u bytes, free at start %u bytes\r\n",
+        GUI_CFG_USE_MEM_TLSF ? "TLSF" : "first-fit", GUI_CFG_USE_MEM_POOL ? " with pools" : "", (unsigned)HEAP_SIZE, (unsigned)gui_mem_getfree());
+
+    for (size_t step = 0; step < STEPS; step++) {
+        idx = rnd(MAX_SCREENS);                     /* Switch one of the screens */
+        screen_destroy(&screens[idx]);
+        screen_create(&screens[idx]);
+
+        for (size_t i = 0; i < 4; i++) {           /* Long-lived cache entries in between */
+            idx = rnd(MAX_CACHE);
+            bench_free(cache[idx], 0);
+            cache[idx] = bench_alloc(16 + rnd(240), 0, 1);
+        }
+    }
+    for (idx = 0; idx < MAX_SCREENS; idx++) {
+        screen_destroy(&screens[idx]);
+    }
+    for (idx = 0; idx < MAX_CACHE; idx++) {
+        bench_free(cache[idx], 0);
+    }
+
+    report("alloc fixed", &t_alloc[1]);
+    report("free fixed", &t_free[1]);
+    report("alloc other", &t_alloc[0]);
+    report("free other", &t_free[0]);
+    printf("Failed allocations: %u, minimal free: %u bytes, free at end: %u bytes\r\n",
+        (unsigned)n_fail, (unsigned)gui_mem_getminfree(), (unsigned)gui_mem_getfree());
+#if GUI_CFG_USE_MEM_POOL
+    {
+        gui_mem_pool_info_t info;
+
+        for (idx = 0; gui_mem_pool_getinfo(idx, &info); idx++) {  /* Slabs kept after all objects are freed */
+            printf("Pool %4u bytes: %u slabs kept, %u used, %u max used, %u bytes\r\n",
+                (unsigned)info.block_size, (unsigned)info.slabs, (unsigned)info.used,
+                (unsigned)info.max_used, (unsigned)info.mem_size);
+        }
+    }
+#endif /* GUI_CFG_USE_MEM_POOL */
+    return 0;
+}
@@ -0,0 +1,355 @@
+/**
+ * \file            trid.c
+ * \brief           Translation ID generator for source language table
+ */
+
+ 
+/*
+ * Copyright (c) 2020 Tilen MAJERLE
+ *  
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without restriction,
+ * including without limitation the rights to use, copy, modify, merge,
+ * publish, distribute, sublicense, and/or sell copies of the Software, 
+ * and to permit persons to whom the Software is furnished to do so, 
+ * subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE
+ * AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING 
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * This file is part of EasyGUI library.
+ *
+ * Author:          Tilen MAJERLE <tilen@majerle.eu>
+ * Version:         $_version_$
+ */
+
+/*
+ * Host tool, build with `make`.
+ *
+ * Reads source language entries array from C source and writes header
+ * with enumeration of entry indexes, used with \ref gui_translate_getid
+ * and \ref gui_widget_settextid.
+ *
+ * Usage:
+ *
+ *  trid -i lang_en.c -a entries_array [-p TR_] -o tr_ids.h
+ *
+ *  -i: C source file with source language entries array
+ *  -a: Name of entries array
+ *  -p: Prefix of generated names, default `TR_`
+ *  -o: Output header file
+ *
+ * Names are built from entry text with letters and digits in upper case
+ * and other characters replaced with `_`. Entries without text are named by index,
+ * duplicated names get index suffix.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_NAME            40              /* Maximal length of name without prefix */
+
+/**
+ * \brief           Source entry
+ */
+typedef struct {
+    char* text;                             /*!< Entry text, `NULL` when entry has no string literal */
+    size_t len;                             /*!< Length of text */
+    char name[MAX_NAME + 16];               /*!< Generated name without prefix */
+} entry_t;
+
+static entry_t* entries;
+static size_t entries_count, entries_size;
+
+/**
+ * \brief           Print error and exit
+ */
+static void
+fail(const char* msg, const char* arg) {
+    fprintf(stderr, "trid: %s%s%s\n", msg, arg != NULL ? ": " : "", arg != NULL ? arg : "");
+    exit(1);
+}
+
+/**
+ * \brief           Read complete file to memory
+ */
+static char*
+read_file(const char* path, size_t* len) {
+    FILE* f = fopen(path, "rb");
+    char* data;
+    long n;
+
+    if (f == NULL) {
+        fail("cannot open file", path);
+    }
+    fseek(f, 0, SEEK_END);
+    n = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    data = malloc((size_t)n + 1);
+    if (data == NULL || fread(data, 1, (size_t)n, f) != (size_t)n) {
+        fail("cannot read file", path);
+    }
+    data[n] = 0;
+    fclose(f);
+    *len = (size_t)n;
+    return data;
+}
+
+/**
+ * \brief           Skip white spaces and comments
+ * \return          Index of next token
+ */
+static size_t
+skip_space(const char* s, size_t i, size_t len) {
+    while (i < len) {
+        if (isspace((unsigned char)s[i])) {
+            i++;
+        } else if (s[i] == '/' && s[i + 1] == '/') {
+            while (i < len && s[i] != '\n') {
+                i++;
+            }
+        } else if (s[i] == '/' && s[i + 1] == '*') {
+            for (i += 2; i < len && !(s[i] == '*' && s[i + 1] == '/'); i++) {}
+            i += 2;
+        } else {
+            break;
+        }
+    }
+    return i;
+}
+
+/**
+ * \brief           Append string literal starting at quote to current entry
+ * \return          Index after closing quote
+ */
+static size_t
+read_literal(const char* s, size_t i, size_t len, entry_t* e) {
+    e->text = realloc(e->text, e->len + (len - i) + 1);
+    if (e->text == NULL) {
+        fail("out of memory", NULL);
+    }
+    for (i++; i < len && s[i] != '"'; i++) {
+        char c = s[i];
+        if (c == '\\' && i + 1 < len) {
+            i++;
+            switch (s[i]) {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'x': {
+                    unsigned v = 0;
+                    while (i + 1 < len && isxdigit((unsigned char)s[i + 1])) {
+                        i++;
+                        v = v * 16 + (isdigit((unsigned char)s[i]) ? s[i] - '0' : (tolower((unsigned char)s[i]) - 'a' + 10));
+                    }
+                    c = (char)v;
+                    break;
+                }
+                default: c = s[i]; break;
+            }
+        }
+        e->text[e->len++] = c;
+    }
+    e->text[e->len] = 0;
+    return i + 1;
+}
+
+/**
+ * \brief           Find entries array in source and read all entries
+ */
+static void
+read_entries(const char* s, size_t len, const char* array) {
+    size_t i, n = strlen(array), depth = 0;
+    entry_t* e = NULL;
+
+    /* Find array name followed by optional dimension, `=` and `{` */
+    for (i = 0; i < len; i++) {
+        size_t k;
+        i = skip_space(s, i, len);
+        if (strncmp(s + i, array, n) || (i > 0 && (isalnum((unsigned char)s[i - 1]) || s[i - 1] == '_'))
+            || isalnum((unsigned char)s[i + n]) || s[i + n] == '_') {
+            continue;
+        }
+        k = skip_space(s, i + n, len);
+        if (s[k] == '[') {
+            while (k < len && s[k] != ']') {
+                k++;
+            }
+            k = skip_space(s, k + 1, len);
+        }
+        if (s[k] != '=') {
+            continue;
+        }
+        k = skip_space(s, k + 1, len);
+        if (s[k] == '{') {
+            i = k + 1;
+            break;
+        }
+    }
+    if (i >= len) {
+        fail("entries array not found", array);
+    }
+
+    /* Each top level comma closes one entry */
+    while ((i = skip_space(s, i, len)) < len) {
+        if (s[i] == '}' && depth == 0) {
+            break;
+        }
+        if (e == NULL) {
+            if (entries_count == entries_size) {
+                entries_size = entries_size ? 2 * entries_size : 256;
+                entries = realloc(entries, entries_size * sizeof(*entries));
+                if (entries == NULL) {
+                    fail("out of memory", NULL);
+                }
+            }
+            e = &entries[entries_count++];
+            memset(e, 0x00, sizeof(*e));
+        }
+        if (s[i] == '"') {
+            i = read_literal(s, i, len, e);
+            continue;
+        } else if (s[i] == '(' || s[i] == '{') {
+            depth++;
+        } else if ((s[i] == ')' || s[i] == '}') && depth > 0) {
+            depth--;
+        } else if (s[i] == ',' && depth == 0) {
+            e = NULL;
+        }
+        i++;
+    }
+    if (i >= len) {
+        fail("entries array is not closed", array);
+    }
+}
+
+/**
+ * \brief           Build unique names of all entries
+ */
+static void
+build_names(void) {
+    size_t i, k, n;
+
+    for (i = 0; i < entries_count; i++) {
+        entry_t* e = &entries[i];
+
+        for (k = 0, n = 0; e->text != NULL && k < e->len && n < MAX_NAME; k++) {
+            unsigned char c = (unsigned char)e->text[k];
+            if (c < 0x80 && isalnum(c)) {
+                e->name[n++] = (char)toupper(c);
+            } else if (n > 0 && e->name[n - 1] != '_') {
+                e->name[n++] = '_';
+            }
+        }
+        while (n > 0 && e->name[n - 1] == '_') {
+            n--;
+        }
+        e->name[n] = 0;
+        if (n == 0) {
+            sprintf(e->name, "ENTRY_%u", (unsigned)i);
+        }
+        for (k = 0; k < i; k++) {
+            if (!strcmp(entries[k].name, e->name)) {
+                sprintf(e->name + strlen(e->name), "_%u", (unsigned)i);
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * \brief           Write entry text as C comment, shortened and with special characters escaped
+ */
+static void
+write_comment(FILE* f, const entry_t* e) {
+    size_t k;
+
+    if (e->text == NULL) {
+        fprintf(f, "/* No text */");
+        return;
+    }
+    fprintf(f, "/* \"");
+    for (k = 0; k < e->len && k < MAX_NAME; k++) {
+        unsigned char c = (unsigned char)e->text[k];
+        if (c == '\n') {
+            fprintf(f, "\\n");
+        } else if (c < 0x20 || (c == '/' && k > 0 && e->text[k - 1] == '*')) {
+            fprintf(f, "\\x%02X", c);
+        } else {
+            fputc(c, f);
+        }
+    }
+    fprintf(f, "\"%s */", k < e->len ? "..." : "");
+}
+
+int
+main(int argc, char** argv) {
+    const char *in_path = NULL, *out_path = NULL, *array = NULL, *prefix = "TR_", *base;
+    char guard[128], *src;
+    size_t i, len;
+    FILE* f;
+
+    for (i = 1; i < (size_t)argc; i++) {
+        const char* a = argv[i];
+        const char* v = i + 1 < (size_t)argc ? argv[i + 1] : NULL;
+        if (a[0] != '-' || v == NULL) {
+            fail("invalid argument, check source file for usage", a);
+        }
+        i++;
+        switch (a[1]) {
+            case 'i': in_path = v; break;
+            case 'a': array = v; break;
+            case 'p': prefix = v; break;
+            case 'o': out_path = v; break;
+            default: fail("unknown option", a);
+        }
+    }
+    if (in_path == NULL || array == NULL || out_path == NULL) {
+        fail("input file, array name and output file are required", NULL);
+    }
+
+    src = read_file(in_path, &len);
+    read_entries(src, len, array);
+    build_names();
+
+    /* Include guard from output file name */
+    base = strrchr(out_path, '/') != NULL ? strrchr(out_path, '/') + 1 : out_path;
+    for (i = 0; base[i] && i < sizeof(guard) - 1; i++) {
+        guard[i] = isalnum((unsigned char)base[i]) ? (char)toupper((unsigned char)base[i]) : '_';
+    }
+    guard[i] = 0;
+
+    if ((f = fopen(out_path, "w")) == NULL) {
+        fail("cannot create output", out_path);
+    }
+    fprintf(f, "/*\n * Translation IDs of %s in %s\n", array, in_path);
+    fprintf(f, " * Generated by trid, regenerate when source table changes\n */\n");
+    fprintf(f, "#ifndef %s\n#define %s\n\nenum {\n", guard, guard);
+    for (i = 0; i < entries_count; i++) {
+        int w = fprintf(f, "    %s%s = %u,", prefix, entries[i].name, (unsigned)i);
+        fprintf(f, "%*s", w < 52 ? 52 - w : 1, "");
+        write_comment(f, &entries[i]);
+        fprintf(f, "\n");
+    }
+    fprintf(f, "    %sCOUNT = %u\n};\n\n#endif /* %s */\n", prefix, (unsigned)entries_count, guard);
+    fclose(f);
+
+    printf("%s: %u entries\n", array, (unsigned)entries_count);
+    for (i = 0; i < entries_count; i++) {
+        free(entries[i].text);
+    }
+    free(entries);
+    free(src);
+    return 0;
+}